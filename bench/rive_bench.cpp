@@ -0,0 +1,284 @@
+// Standalone microbenchmark for the Rive side of the integration.
+// Links the rive runtime only (no Godot, no GPU), draws into a counting no-op renderer
+// and writes the results as JSON.
+//
+// Usage: rive_bench [--riv project/juice.riv] [--svg project/Ghostscript_Tiger.svg]
+//                   [--iterations 200] [--output bench.json]
+
+#include "rive/file.hpp"
+#include "rive/artboard.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/math/raw_path.hpp"
+#include "utils/no_op_factory.hpp"
+#include "utils/no_op_renderer.hpp"
+
+#include "resources/rive_svg_path.h"
+
+#define NANOSVG_IMPLEMENTATION
+#include "nanosvg.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::string riv_path = "project/juice.riv";
+    std::string svg_path = "project/Ghostscript_Tiger.svg";
+    std::string output_path;
+    int iterations = 200;
+};
+
+struct Result {
+    std::string name;
+    int iterations = 0;
+    double min_usec = 0.0;
+    double median_usec = 0.0;
+    double mean_usec = 0.0;
+    std::string extra;
+};
+
+class CountingRenderer : public rive::NoOpRenderer {
+public:
+    uint64_t path_count = 0;
+    uint64_t clip_count = 0;
+
+    void drawPath(rive::RenderPath *path, rive::RenderPaint *paint) override { path_count++; }
+    void clipPath(rive::RenderPath *path) override { clip_count++; }
+};
+
+// Adapts rive::RawPath to the sink interface of rive_svg_path::parse, the same calls RivePath forwards.
+struct RawPathSink {
+    rive::RawPath path;
+
+    void move_to(float x, float y) { path.moveTo(x, y); }
+    void line_to(float x, float y) { path.lineTo(x, y); }
+    void cubic_to(float ox, float oy, float ix, float iy, float x, float y) { path.cubicTo(ox, oy, ix, iy, x, y); }
+    void close() { path.close(); }
+};
+
+double now_usec() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Result measure(const std::string &name, int iterations, const std::function<void()> &fn) {
+    std::vector<double> samples;
+    samples.reserve(iterations);
+
+    fn(); // Warm up caches and lazy allocations.
+    for (int i = 0; i < iterations; i++) {
+        double start = now_usec();
+        fn();
+        samples.push_back(now_usec() - start);
+    }
+
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (double sample : samples) sum += sample;
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.min_usec = samples.front();
+    result.median_usec = samples[samples.size() / 2];
+    result.mean_usec = sum / samples.size();
+    return result;
+}
+
+bool read_file(const std::string &path, std::vector<uint8_t> &r_bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    r_bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Collects every d="..." attribute, which is what RivePath::parse_svg is fed from scripts.
+std::vector<std::string> extract_path_data(const std::string &svg) {
+    std::vector<std::string> paths;
+    size_t pos = 0;
+    while ((pos = svg.find(" d=\"", pos)) != std::string::npos) {
+        pos += 4;
+        size_t end = svg.find('"', pos);
+        if (end == std::string::npos) break;
+        paths.push_back(svg.substr(pos, end - pos));
+        pos = end + 1;
+    }
+    return paths;
+}
+
+bool parse_args(int argc, char **argv, Options &r_options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return false;
+        }
+        if (arg == "--riv") {
+            r_options.riv_path = argv[++i];
+        } else if (arg == "--svg") {
+            r_options.svg_path = argv[++i];
+        } else if (arg == "--iterations") {
+            r_options.iterations = std::max(1, atoi(argv[++i]));
+        } else if (arg == "--output") {
+            r_options.output_path = argv[++i];
+        } else {
+            fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string json_escape(const std::string &str) {
+    std::string out;
+    for (char c : str) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+void bench_riv(const Options &options, rive::Factory *factory, std::vector<Result> &r_results) {
+    std::vector<uint8_t> bytes;
+    if (!read_file(options.riv_path, bytes)) {
+        fprintf(stderr, "Failed to read %s\n", options.riv_path.c_str());
+        return;
+    }
+    rive::Span<const uint8_t> span(bytes.data(), bytes.size());
+
+    r_results.push_back(measure("file_import", options.iterations, [&]() {
+        rive::rcp<rive::File> file = rive::File::import(span, factory);
+    }));
+
+    rive::ImportResult import_result;
+    rive::rcp<rive::File> file = rive::File::import(span, factory, &import_result);
+    if (!file) {
+        fprintf(stderr, "Failed to import %s (%d)\n", options.riv_path.c_str(), (int)import_result);
+        return;
+    }
+
+    r_results.push_back(measure("artboard_instantiate", options.iterations, [&]() {
+        std::unique_ptr<rive::ArtboardInstance> artboard = file->artboardDefault();
+    }));
+
+    std::unique_ptr<rive::ArtboardInstance> artboard = file->artboardDefault();
+    if (!artboard) return;
+
+    if (artboard->stateMachineCount() > 0) {
+        r_results.push_back(measure("state_machine_instantiate", options.iterations, [&]() {
+            std::unique_ptr<rive::StateMachineInstance> state_machine = artboard->stateMachineAt(0);
+        }));
+
+        const float deltas[] = { 1.0f / 240.0f, 1.0f / 60.0f, 1.0f / 30.0f, 0.25f };
+        const char *delta_names[] = { "1_240", "1_60", "1_30", "1_4" };
+        for (int i = 0; i < 4; i++) {
+            std::unique_ptr<rive::ArtboardInstance> sm_artboard = file->artboardDefault();
+            std::unique_ptr<rive::StateMachineInstance> state_machine = sm_artboard->stateMachineAt(0);
+            float delta = deltas[i];
+            r_results.push_back(measure(std::string("state_machine_advance_") + delta_names[i], options.iterations * 5, [&]() {
+                state_machine->advance(delta);
+                sm_artboard->advance(delta);
+            }));
+        }
+    }
+
+    artboard->advance(0.0f);
+    CountingRenderer renderer;
+    Result draw = measure("artboard_draw", options.iterations, [&]() {
+        artboard->draw(&renderer);
+    });
+    uint64_t runs = options.iterations + 1;
+    draw.extra = "\"paths_per_draw\": " + std::to_string(renderer.path_count / runs) + ", \"clips_per_draw\": " + std::to_string(renderer.clip_count / runs);
+    r_results.push_back(draw);
+}
+
+void bench_svg(const Options &options, rive::Factory *factory, std::vector<Result> &r_results) {
+    std::vector<uint8_t> bytes;
+    if (!read_file(options.svg_path, bytes)) {
+        fprintf(stderr, "Failed to read %s\n", options.svg_path.c_str());
+        return;
+    }
+    std::string svg(bytes.begin(), bytes.end());
+
+    std::vector<std::string> path_data = extract_path_data(svg);
+    size_t segment_count = 0;
+    Result parse_svg = measure("rive_path_parse_svg", options.iterations, [&]() {
+        segment_count = 0;
+        for (const std::string &d : path_data) {
+            RawPathSink sink;
+            rive_svg_path::parse(d.c_str(), (int)d.size(), sink);
+            segment_count += sink.path.verbs().size();
+        }
+    });
+    parse_svg.extra = "\"paths\": " + std::to_string(path_data.size()) + ", \"verbs\": " + std::to_string(segment_count);
+    r_results.push_back(parse_svg);
+
+    // Like RiveSVG::parse: nanosvg parse, then one path (built by the same rive_svg_path::emit_shape)
+    // and render path per visible shape.
+    size_t shape_count = 0;
+    Result svg_parse = measure("rive_svg_parse", options.iterations, [&]() {
+        std::vector<char> input(svg.begin(), svg.end());
+        input.push_back('\0');
+
+        NSVGimage *image = nsvgParse(input.data(), "px", 96.0f);
+        if (!image) return;
+
+        shape_count = 0;
+        for (NSVGshape *shape = image->shapes; shape != nullptr; shape = shape->next) {
+            if (!(shape->flags & NSVG_FLAGS_VISIBLE)) continue;
+
+            RawPathSink sink;
+            rive_svg_path::emit_shape(shape, sink);
+            rive::rcp<rive::RenderPath> render_path = factory->makeRenderPath(sink.path, (rive::FillRule)shape->fillRule);
+            shape_count++;
+        }
+        nsvgDelete(image);
+    });
+    svg_parse.extra = "\"shapes\": " + std::to_string(shape_count);
+    r_results.push_back(svg_parse);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parse_args(argc, argv, options)) return 1;
+
+    rive::NoOpFactory factory;
+    std::vector<Result> results;
+
+    bench_riv(options, &factory, results);
+    bench_svg(options, &factory, results);
+
+    std::string json = "{\n  \"riv\": \"" + json_escape(options.riv_path) + "\",\n  \"svg\": \"" + json_escape(options.svg_path) + "\",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &r = results[i];
+        char line[512];
+        snprintf(line, sizeof(line), "    {\"name\": \"%s\", \"iterations\": %d, \"min_usec\": %.3f, \"median_usec\": %.3f, \"mean_usec\": %.3f",
+                r.name.c_str(), r.iterations, r.min_usec, r.median_usec, r.mean_usec);
+        json += line;
+        if (!r.extra.empty()) json += ", " + r.extra;
+        json += (i + 1 < results.size()) ? "},\n" : "}\n";
+    }
+    json += "  ]\n}\n";
+
+    if (options.output_path.empty()) {
+        fputs(json.c_str(), stdout);
+    } else {
+        std::ofstream out(options.output_path);
+        if (!out) {
+            fprintf(stderr, "Failed to write %s\n", options.output_path.c_str());
+            return 1;
+        }
+        out << json;
+    }
+
+    return results.empty() ? 1 : 0;
+}
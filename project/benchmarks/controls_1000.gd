@@ -0,0 +1,17 @@
+extends RiveBenchmark
+## 1,000 RiveControls, each with its own player and render target.
+
+@export var count := 1000
+@export var control_size := Vector2(48, 48)
+
+const RIVE_FILE := preload("res://juice.riv")
+
+
+func _setup_benchmark() -> void:
+	var columns := int(sqrt(count))
+	for i in count:
+		var control := RiveControl.new()
+		control.position = Vector2(i % columns, i / columns) * control_size
+		control.size = control_size
+		control.rive_file = RIVE_FILE
+		add_child(control)
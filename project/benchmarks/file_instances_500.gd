@@ -0,0 +1,20 @@
+extends RiveBenchmark
+## 500 RiveFileInstances under one RiveCanvas2D, advanced on the worker pool.
+
+@export var count := 500
+
+const RIVE_FILE := preload("res://juice.riv")
+
+
+func _setup_benchmark() -> void:
+	var canvas := RiveCanvas2D.new()
+	canvas.size = Vector2i(1152, 648)
+	add_child(canvas)
+
+	var columns := int(sqrt(count))
+	for i in count:
+		var instance := RiveFileInstance.new()
+		instance.rive_file = RIVE_FILE
+		instance.position = Vector2(i % columns, i / columns) * 48.0
+		instance.scale = Vector2(0.1, 0.1)
+		canvas.add_child(instance)
@@ -0,0 +1,44 @@
+extends RiveBenchmark
+## One RiveMultiInstance drawing 10,000 transforms, optionally rewritten every frame.
+
+@export var count := 10000
+@export var animate_transforms := true
+
+const RIVE_FILE := preload("res://Ghostscript_Tiger.svg")
+const INSTANCE_SCALE := 0.02
+
+var _multi: RiveMultiInstance
+# 6 floats per instance: x axis, y axis, origin.
+var _transforms := PackedFloat32Array()
+
+
+func _setup_benchmark() -> void:
+	var canvas := RiveCanvas2D.new()
+	canvas.size = Vector2i(1152, 648)
+	add_child(canvas)
+
+	_multi = RiveMultiInstance.new()
+	_multi.rive_file = RIVE_FILE
+	canvas.add_child(_multi)
+
+	_transforms.resize(count * 6)
+	_write_transforms(Vector2.ZERO)
+
+
+func _step_benchmark(frame_index: int, _delta: float) -> void:
+	if not animate_transforms:
+		return
+	_write_transforms(Vector2(sin(frame_index * 0.05), cos(frame_index * 0.05)) * 4.0)
+
+
+func _write_transforms(offset: Vector2) -> void:
+	var columns := int(sqrt(count))
+	for i in count:
+		var o := i * 6
+		_transforms[o] = INSTANCE_SCALE
+		_transforms[o + 1] = 0.0
+		_transforms[o + 2] = 0.0
+		_transforms[o + 3] = INSTANCE_SCALE
+		_transforms[o + 4] = (i % columns) * 12.0 + offset.x
+		_transforms[o + 5] = (i / columns) * 12.0 + offset.y
+	_multi.set_instance_transforms(_transforms)
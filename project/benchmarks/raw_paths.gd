@@ -0,0 +1,47 @@
+extends RiveBenchmark
+## Many RiveRaw nodes issuing draw_path calls, with some paths re-parsed every frame.
+
+@export var node_count := 200
+@export var paths_per_node := 20
+@export var reparse_per_frame := 100
+
+var _paths: Array[RivePath] = []
+var _paints: Array[RivePaint] = []
+
+
+func _setup_benchmark() -> void:
+	var canvas := RiveCanvas2D.new()
+	canvas.size = Vector2i(1152, 648)
+	add_child(canvas)
+
+	for i in paths_per_node:
+		var path := RivePath.new()
+		path.parse_svg(_make_path_data(i, 0))
+		_paths.append(path)
+
+		var paint := RivePaint.new()
+		paint.set_color(Color.from_hsv(float(i) / paths_per_node, 0.8, 0.9))
+		_paints.append(paint)
+
+	var columns := int(sqrt(node_count))
+	for i in node_count:
+		var raw := RiveRaw.new()
+		raw.position = Vector2(i % columns, i / columns) * 64.0
+		raw.draw_rive.connect(_on_draw_rive)
+		canvas.add_child(raw)
+
+
+func _step_benchmark(frame_index: int, _delta: float) -> void:
+	for i in mini(reparse_per_frame, _paths.size()):
+		_paths[i].reset()
+		_paths[i].parse_svg(_make_path_data(i, frame_index))
+
+
+func _on_draw_rive(renderer: RiveRendererWrapper) -> void:
+	for i in _paths.size():
+		renderer.draw_path(_paths[i], _paints[i])
+
+
+func _make_path_data(index: int, frame_index: int) -> String:
+	var r := 8.0 + (index + frame_index) % 16
+	return "M %.1f 0 C %.1f %.1f %.1f %.1f 0 %.1f S %.1f %.1f %.1f 0 Z" % [r, r, r, r, r, r, -r, r, -r]
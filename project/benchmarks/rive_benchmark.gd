@@ -0,0 +1,117 @@
+class_name RiveBenchmark
+extends Node
+## Base class for the stress scenes in this folder.
+##
+## Subclasses build their content in _setup_benchmark() and may mutate it every frame in
+## _step_benchmark(). After warmup_frames + frames the frame-time percentiles and the Rive
+## monitor values are appended to a CSV file and the scene quits.
+##
+## Command line options (after "--"): --frames=N --warmup=N --csv=path
+
+@export var frames := 600
+@export var warmup_frames := 60
+@export var csv_path := "user://rive_benchmarks.csv"
+
+const MONITORS: Array[String] = [
+	"Rive/Total Memory",
+	"Rive/File Memory",
+	"Rive/Texture Memory",
+	"Rive/Render Targets",
+	"Rive/Artboards",
+	"Rive/State Machines",
+	"Rive/View Models",
+]
+
+var _frame_times := PackedFloat64Array()
+var _frame := 0
+var _last_usec := 0
+
+
+func _ready() -> void:
+	_parse_args()
+	_setup_benchmark()
+	_last_usec = Time.get_ticks_usec()
+
+
+func _process(delta: float) -> void:
+	var now := Time.get_ticks_usec()
+	var frame_msec := (now - _last_usec) / 1000.0
+	_last_usec = now
+
+	_step_benchmark(_frame, delta)
+	_frame += 1
+
+	if _frame > warmup_frames:
+		_frame_times.append(frame_msec)
+	if _frame >= warmup_frames + frames:
+		_write_results()
+		get_tree().quit()
+
+
+## Builds the scene content. Called once from _ready().
+func _setup_benchmark() -> void:
+	pass
+
+
+## Called at the start of every frame, including warmup frames.
+func _step_benchmark(_frame_index: int, _delta: float) -> void:
+	pass
+
+
+func _get_scenario_name() -> String:
+	return get_scene_file_path().get_file().get_basename()
+
+
+func _parse_args() -> void:
+	for arg in OS.get_cmdline_user_args():
+		if arg.begins_with("--frames="):
+			frames = arg.get_slice("=", 1).to_int()
+		elif arg.begins_with("--warmup="):
+			warmup_frames = arg.get_slice("=", 1).to_int()
+		elif arg.begins_with("--csv="):
+			csv_path = arg.get_slice("=", 1)
+
+
+func _percentile(sorted: PackedFloat64Array, p: float) -> float:
+	if sorted.is_empty():
+		return 0.0
+	var index := clampi(int(ceil(p * sorted.size())) - 1, 0, sorted.size() - 1)
+	return sorted[index]
+
+
+func _write_results() -> void:
+	var sorted := _frame_times.duplicate()
+	sorted.sort()
+
+	var total := 0.0
+	for t in sorted:
+		total += t
+	var mean := total / maxi(sorted.size(), 1)
+
+	var header := PackedStringArray(["scenario", "driver", "frames", "mean_ms", "p50_ms", "p90_ms", "p99_ms", "max_ms"])
+	var row := PackedStringArray([
+		_get_scenario_name(),
+		RenderingServer.get_current_rendering_driver_name(),
+		str(sorted.size()),
+		"%.3f" % mean,
+		"%.3f" % _percentile(sorted, 0.5),
+		"%.3f" % _percentile(sorted, 0.9),
+		"%.3f" % _percentile(sorted, 0.99),
+		"%.3f" % (sorted[sorted.size() - 1] if not sorted.is_empty() else 0.0),
+	])
+	for monitor in MONITORS:
+		header.append(monitor.get_file().to_snake_case())
+		row.append(str(Performance.get_custom_monitor(monitor)) if Performance.has_custom_monitor(monitor) else "")
+
+	var exists := FileAccess.file_exists(csv_path)
+	var file := FileAccess.open(csv_path, FileAccess.READ_WRITE if exists else FileAccess.WRITE)
+	if file == null:
+		push_error("RiveBenchmark: Failed to open %s (%s)" % [csv_path, error_string(FileAccess.get_open_error())])
+		return
+	file.seek_end()
+	if not exists:
+		file.store_line(",".join(header))
+	file.store_line(",".join(row))
+	file.close()
+
+	print("%s: mean %.3f ms, p50 %s ms, p99 %s ms -> %s" % [row[0], mean, row[4], row[6], ProjectSettings.globalize_path(csv_path)])
@@ -0,0 +1,43 @@
+extends RiveBenchmark
+## Writes every number, boolean and color view model property of many RiveControls each frame.
+
+@export var count := 200
+
+const RIVE_FILE := preload("res://juice.riv")
+
+var _view_models: Array[RiveViewModelInstance] = []
+var _properties: Array[Dictionary] = []
+
+
+func _setup_benchmark() -> void:
+	var columns := int(sqrt(count))
+	for i in count:
+		var control := RiveControl.new()
+		control.position = Vector2(i % columns, i / columns) * 64.0
+		control.size = Vector2(64, 64)
+		control.rive_file = RIVE_FILE
+		add_child(control)
+
+		var view_model: RiveViewModelInstance = control.get_view_model_instance()
+		if view_model == null:
+			continue
+		_view_models.append(view_model)
+		if _properties.is_empty():
+			for property in view_model.get_property_list():
+				if property.type in [TYPE_FLOAT, TYPE_BOOL, TYPE_COLOR]:
+					_properties.append(property)
+
+	if _view_models.is_empty():
+		push_warning("view_model_churn: %s has no view model, only advance is measured." % RIVE_FILE.resource_path)
+
+
+func _step_benchmark(frame_index: int, _delta: float) -> void:
+	for view_model in _view_models:
+		for property in _properties:
+			match property.type:
+				TYPE_FLOAT:
+					view_model.set(property.name, float(frame_index % 100))
+				TYPE_BOOL:
+					view_model.set(property.name, frame_index % 2 == 0)
+				TYPE_COLOR:
+					view_model.set(property.name, Color.from_hsv(fmod(frame_index * 0.01, 1.0), 1.0, 1.0))
@@ -0,0 +1,180 @@
+extends SceneTree
+## Golden-image regression harness.
+##
+## Renders every artboard x state machine (or animation) x time sample of ASSETS and compares
+## the result with the PNGs in res://golden/expected/. Run it with a deterministic backend,
+## scripts/run_golden.py sets up Vulkan on lavapipe:
+##
+##   godot --path project --rendering-driver vulkan -s res://golden/golden_runner.gd -- [options]
+##
+## Options: --update               rewrite the expected images instead of comparing
+##          --tolerance=N          per-channel difference (0-255) still counted as equal, default 2
+##          --max-diff-ratio=R     fraction of differing pixels allowed per image, default 0.001
+##          --out=DIR              where diff images are written, default user://golden_diff
+
+const ASSETS: Array[String] = [
+	"res://juice.riv",
+	"res://Ghostscript_Tiger.svg",
+]
+const TIME_SAMPLES: Array[float] = [0.0, 0.25, 0.5, 1.0, 2.0]
+const STEP := 1.0 / 60.0
+const IMAGE_SIZE := Vector2i(256, 256)
+const EXPECTED_DIR := "res://golden/expected"
+
+var update := false
+var tolerance := 2
+var max_diff_ratio := 0.001
+var out_dir := "user://golden_diff"
+
+var _ran := false
+
+
+func _process(_delta: float) -> bool:
+	# Render on the first frame, once the renderer and the extension are fully up.
+	if _ran:
+		return true
+	_ran = true
+
+	_parse_args()
+	var failures := _run()
+	quit(1 if failures > 0 else 0)
+	return true
+
+
+func _parse_args() -> void:
+	for arg in OS.get_cmdline_user_args():
+		if arg == "--update":
+			update = true
+		elif arg.begins_with("--tolerance="):
+			tolerance = arg.get_slice("=", 1).to_int()
+		elif arg.begins_with("--max-diff-ratio="):
+			max_diff_ratio = arg.get_slice("=", 1).to_float()
+		elif arg.begins_with("--out="):
+			out_dir = arg.get_slice("=", 1)
+
+
+func _run() -> int:
+	DirAccess.make_dir_recursive_absolute(ProjectSettings.globalize_path(EXPECTED_DIR))
+	DirAccess.make_dir_recursive_absolute(ProjectSettings.globalize_path(out_dir))
+
+	var total := 0
+	var failures := 0
+	for asset_path in ASSETS:
+		var file: RiveFile = load(asset_path)
+		if file == null:
+			printerr("golden: failed to load %s" % asset_path)
+			failures += 1
+			continue
+
+		var artboards := file.get_artboard_names()
+		if artboards.is_empty():
+			artboards = PackedStringArray([""])
+
+		for artboard in artboards:
+			var probe := RivePlayer.new()
+			if not probe.load_artboard(file, artboard):
+				printerr("golden: failed to instantiate artboard '%s' of %s" % [artboard, asset_path])
+				failures += 1
+				continue
+
+			for playback in _get_playbacks(probe):
+				for t in TIME_SAMPLES:
+					var image := _render(file, artboard, playback, t)
+					var case_name := _case_name(asset_path, artboard, playback, t)
+					total += 1
+					if not _check(case_name, image):
+						failures += 1
+
+	if update:
+		print("golden: wrote %d expected images to %s" % [total, ProjectSettings.globalize_path(EXPECTED_DIR)])
+	else:
+		print("golden: %d/%d passed" % [total - failures, total])
+	return failures
+
+
+## Returns [kind, name] pairs: every state machine, or every animation if there are none.
+func _get_playbacks(player: RivePlayer) -> Array:
+	var playbacks := []
+	for state_machine in player.get_state_machine_list():
+		playbacks.append(["sm", state_machine])
+	if playbacks.is_empty():
+		for animation in player.get_animation_list():
+			playbacks.append(["anim", animation])
+	if playbacks.is_empty():
+		playbacks.append(["static", ""])
+	return playbacks
+
+
+func _render(file: RiveFile, artboard: String, playback: Array, t: float) -> Image:
+	# A fresh player per sample, advanced in fixed steps, so results don't depend on order.
+	var player := RivePlayer.new()
+	player.load_artboard(file, artboard)
+	match playback[0]:
+		"sm":
+			player.play_state_machine(playback[1])
+		"anim":
+			player.play_animation(playback[1])
+
+	var steps := roundi(t / STEP)
+	for i in steps:
+		player.advance(STEP)
+	if steps == 0:
+		player.advance(0.0)
+
+	return player.render_to_image(IMAGE_SIZE)
+
+
+func _check(case_name: String, image: Image) -> bool:
+	if image == null:
+		printerr("golden: %s: nothing rendered (the current driver has no readable render target)" % case_name)
+		return false
+
+	var expected_path := ProjectSettings.globalize_path(EXPECTED_DIR.path_join(case_name + ".png"))
+	if update:
+		image.save_png(expected_path)
+		return true
+
+	if not FileAccess.file_exists(expected_path):
+		printerr("golden: %s: missing %s, run with --update" % [case_name, expected_path])
+		image.save_png(ProjectSettings.globalize_path(out_dir.path_join(case_name + ".actual.png")))
+		return false
+
+	var expected := Image.load_from_file(expected_path)
+	if expected.get_size() != image.get_size():
+		printerr("golden: %s: size %s, expected %s" % [case_name, image.get_size(), expected.get_size()])
+		return false
+
+	expected.convert(Image.FORMAT_RGBA8)
+	image.convert(Image.FORMAT_RGBA8)
+
+	var diff := Image.create(image.get_width(), image.get_height(), false, Image.FORMAT_RGBA8)
+	var differing := 0
+	for y in image.get_height():
+		for x in image.get_width():
+			var a := image.get_pixel(x, y)
+			var b := expected.get_pixel(x, y)
+			var delta := maxf(maxf(absf(a.r - b.r), absf(a.g - b.g)), maxf(absf(a.b - b.b), absf(a.a - b.a)))
+			if delta * 255.0 > tolerance:
+				differing += 1
+				diff.set_pixel(x, y, Color(1, 0, 0, 1))
+			else:
+				var v := b.get_luminance() * 0.3
+				diff.set_pixel(x, y, Color(v, v, v, 1))
+
+	var ratio := float(differing) / (image.get_width() * image.get_height())
+	if ratio <= max_diff_ratio:
+		return true
+
+	var base := ProjectSettings.globalize_path(out_dir.path_join(case_name))
+	image.save_png(base + ".actual.png")
+	diff.save_png(base + ".diff.png")
+	printerr("golden: %s: %d pixels differ (%.4f%%), see %s.diff.png" % [case_name, differing, ratio * 100.0, base])
+	return false
+
+
+func _case_name(asset_path: String, artboard: String, playback: Array, t: float) -> String:
+	var parts := PackedStringArray([asset_path.get_file().get_basename(), artboard if not artboard.is_empty() else "default", playback[0]])
+	if not String(playback[1]).is_empty():
+		parts.append(playback[1])
+	parts.append("t%04d" % roundi(t * 1000.0))
+	return "__".join(parts).validate_filename().replace(" ", "_")
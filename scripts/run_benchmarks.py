@@ -0,0 +1,69 @@
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+
+# Runs the stress scenes in project/benchmarks/ one after another and collects their
+# results in a single CSV.
+#
+#   python3 scripts/run_benchmarks.py --godot /path/to/godot --frames 600
+#
+# --driver null     --headless, Rive draws into a no-op renderer (CPU cost only).
+# --driver vulkan   real Vulkan rendering. Without a GPU use Mesa's lavapipe; under no display
+#                   the run is wrapped in xvfb-run when it is available.
+
+SCENES = [
+    "controls_1000",
+    "multi_instance_10k",
+    "file_instances_500",
+    "view_model_churn",
+    "raw_paths",
+]
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    project = os.path.join(root, "project")
+
+    parser = argparse.ArgumentParser(description="Run RiveGD benchmark scenes")
+    parser.add_argument("--godot", default=os.environ.get("GODOT", "godot"), help="Godot executable (default: $GODOT or godot)")
+    parser.add_argument("--driver", choices=["null", "vulkan"], default="null")
+    parser.add_argument("--frames", type=int, default=600)
+    parser.add_argument("--warmup", type=int, default=60)
+    parser.add_argument("--csv", default=os.path.join(root, "bench_output.csv"))
+    parser.add_argument("scenes", nargs="*", default=SCENES)
+    args = parser.parse_args()
+
+    csv_path = os.path.abspath(args.csv)
+    if os.path.exists(csv_path):
+        os.remove(csv_path)
+
+    failed = []
+    for scene in args.scenes:
+        cmd = [args.godot, "--path", project]
+        if args.driver == "null":
+            cmd.append("--headless")
+        else:
+            cmd += ["--rendering-driver", "vulkan"]
+            if not os.environ.get("DISPLAY") and shutil.which("xvfb-run"):
+                cmd = ["xvfb-run", "-a"] + cmd
+        cmd += [
+            "res://benchmarks/{}.tscn".format(scene),
+            "--",
+            "--frames={}".format(args.frames),
+            "--warmup={}".format(args.warmup),
+            "--csv={}".format(csv_path),
+        ]
+
+        print("Running: {}".format(" ".join(cmd)))
+        if subprocess.call(cmd) != 0:
+            failed.append(scene)
+
+    print("Results: {}".format(csv_path))
+    if failed:
+        print("Failed: {}".format(", ".join(failed)))
+        return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,68 @@
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+
+# Runs the golden-image harness (project/golden/golden_runner.gd) on a deterministic backend.
+#
+#   python3 scripts/run_golden.py --godot /path/to/godot            # compare
+#   python3 scripts/run_golden.py --godot /path/to/godot --update   # rewrite expected images
+#
+# By default Vulkan runs on Mesa's lavapipe (software), so results don't depend on the GPU or
+# its driver. Expected images must be generated with the same backend they are compared on.
+
+def find_lavapipe_icd():
+    for pattern in ["/usr/share/vulkan/icd.d/lvp_icd*.json", "/usr/local/share/vulkan/icd.d/lvp_icd*.json"]:
+        matches = glob.glob(pattern)
+        if matches:
+            return matches[0]
+    return None
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    project = os.path.join(root, "project")
+
+    parser = argparse.ArgumentParser(description="Run RiveGD golden-image tests")
+    parser.add_argument("--godot", default=os.environ.get("GODOT", "godot"), help="Godot executable (default: $GODOT or godot)")
+    parser.add_argument("--update", action="store_true", help="Rewrite the expected images")
+    parser.add_argument("--tolerance", type=int, default=2, help="Per-channel difference (0-255) treated as equal")
+    parser.add_argument("--max-diff-ratio", type=float, default=0.001, help="Fraction of differing pixels allowed")
+    parser.add_argument("--out", default=os.path.join(root, "golden_diff"), help="Directory for diff images")
+    parser.add_argument("--gpu", action="store_true", help="Use the system Vulkan driver instead of lavapipe")
+    args = parser.parse_args()
+
+    if args.update and args.gpu:
+        # Committed baselines are compared on lavapipe, images from a GPU driver would not match.
+        print("--update records the committed baselines and only runs on lavapipe, drop --gpu")
+        return 1
+
+    expected_dir = os.path.join(project, "golden", "expected")
+    if not args.update and not glob.glob(os.path.join(expected_dir, "*.png")):
+        # Every case would fail as missing, say what to do instead.
+        print("No expected images in {}. Record them on lavapipe with --update and commit them.".format(expected_dir))
+        return 1
+
+    env = dict(os.environ)
+    if not args.gpu:
+        icd = find_lavapipe_icd()
+        if not icd:
+            print("lavapipe ICD not found, install Mesa's Vulkan drivers (e.g. mesa-vulkan-drivers) or pass --gpu")
+            return 1
+        env["VK_ICD_FILENAMES"] = icd
+        env["VK_DRIVER_FILES"] = icd
+
+    cmd = [args.godot, "--path", project, "--rendering-driver", "vulkan", "-s", "res://golden/golden_runner.gd"]
+    if not env.get("DISPLAY") and shutil.which("xvfb-run"):
+        cmd = ["xvfb-run", "-a"] + cmd
+
+    cmd += ["--", "--tolerance={}".format(args.tolerance), "--max-diff-ratio={}".format(args.max_diff_ratio), "--out={}".format(os.path.abspath(args.out))]
+    if args.update:
+        cmd.append("--update")
+
+    print("Running: {}".format(" ".join(cmd)))
+    return subprocess.call(cmd, env=env)
+
+if __name__ == "__main__":
+    sys.exit(main())
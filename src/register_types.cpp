@@ -7,7 +7,11 @@
 
 #include "renderer/rive_renderer.h"
 #include "rive_svg.h"
+#include "rive_profiler.h"
+#include "rive_monitors.h"
 #include "resources/rive_file.h"
+#include "resources/rive_flipbook.h"
+#include "resources/rive_artboard_handle.h"
 #include "resources/rive_types.h"
 #include "scene/rive_node.h"
 #include "scene/rive_file_instance.h"
@@ -16,6 +20,7 @@
 #include "scene/rive_canvas_2d.h"
 #include "scene/rive_raw.h"
 #include "scene/rive_player.h"
+#include "scene/rive_advance_scheduler.h"
 #include "scene/rive_view_model.h"
 #include "renderer/rive_texture_target.h"
 #include "editor/rive_editor_plugin.h"
@@ -31,8 +36,11 @@ void initialize_rive_module(ModuleInitializationLevel p_level) {
         ClassDB::register_class<RivePaint>();
         ClassDB::register_class<RiveRendererWrapper>();
         ClassDB::register_class<RiveSVG>();
+        ClassDB::register_abstract_class<RiveProfiler>();
         
         ClassDB::register_class<RiveFile>();
+        ClassDB::register_class<RiveFlipbook>();
+        ClassDB::register_class<RiveArtboardHandle>();
         ClassDB::register_class<RiveNode>();
         ClassDB::register_class<RiveFileInstance>();
         ClassDB::register_class<RiveMultiInstance>();
@@ -40,6 +48,7 @@ void initialize_rive_module(ModuleInitializationLevel p_level) {
         ClassDB::register_class<RiveCanvas2D>();
         
         ClassDB::register_class<RivePlayer>();
+        ClassDB::register_class<RiveRecording>();
         ClassDB::register_class<RiveTextureTarget>();
         
         ClassDB::register_abstract_class<RiveViewModelProperty>();
@@ -66,10 +75,13 @@ void initialize_rive_module(ModuleInitializationLevel p_level) {
 
 void initialize_rive() {
 	rive_integration::initialize_rive_renderer();
+	rive_monitors::register_monitors();
 }
 
 void uninitialize_rive_module(ModuleInitializationLevel p_level) {
     if (p_level == MODULE_INITIALIZATION_LEVEL_SCENE) {
+        rive_monitors::unregister_monitors();
+        RiveAdvanceScheduler::free_singleton();
         rive_integration::cleanup_rive_renderer();
     }
 }
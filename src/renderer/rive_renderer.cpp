@@ -1,5 +1,6 @@
 #include "rive_renderer.h"
 #include "rive_render_registry.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/classes/rendering_device.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -30,6 +31,10 @@ bool create_opengl_context();
 void render_texture_opengl(RID texture_rid, RiveDrawable *drawable, uint32_t width, uint32_t height);
 #endif
 
+bool create_null_context();
+void render_texture_null(RiveDrawable *drawable);
+void cleanup_null_context();
+
 void initialize_rive_renderer() {
     RenderingServer *rs = RenderingServer::get_singleton();
     if (!rs) return;
@@ -64,6 +69,8 @@ void initialize_rive_renderer() {
 #else
         UtilityFunctions::printerr("Rive: OpenGL support not compiled in.");
 #endif
+    } else if (api == "dummy") {
+        success = create_null_context();
     } else {
         UtilityFunctions::printerr("Rive: Unsupported graphics API: " + api);
     }
@@ -89,6 +96,8 @@ void cleanup_rive_renderer() {
 #if defined(VULKAN_ENABLED)
         cleanup_vulkan_context();
 #endif
+    } else if (api == "dummy") {
+        cleanup_null_context();
     }
     // Add other backends cleanup if needed
 }
@@ -96,6 +105,8 @@ void cleanup_rive_renderer() {
 void render_texture(RenderingDevice *rd, RID texture_rid, RiveDrawable *drawable, uint32_t width, uint32_t height) {
     RenderingServer *rs = RenderingServer::get_singleton();
     if (!rs) return;
+
+    RIVE_PROFILE_ZONE("rive_integration::render_texture");
     
     String api = rs->get_current_rendering_driver_name();
     
@@ -115,6 +126,8 @@ void render_texture(RenderingDevice *rd, RID texture_rid, RiveDrawable *drawable
 #if defined(RIVE_DESKTOP_GL)
         render_texture_opengl(texture_rid, drawable, width, height);
 #endif
+    } else if (api == "dummy") {
+        render_texture_null(drawable);
     }
 }
 
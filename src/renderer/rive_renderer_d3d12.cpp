@@ -2,6 +2,7 @@
 #include "rive/renderer/render_context.hpp"
 #include "rive/renderer/rive_renderer.hpp"
 #include "rive_render_registry.h"
+#include "../rive_profiler.h"
 
 #include <godot_cpp/classes/rendering_device.hpp>
 #include <godot_cpp/classes/os.hpp>
@@ -284,6 +285,7 @@ void render_texture_d3d12(RenderingDevice *rd, RID texture_rid, RiveDrawable *dr
 			fr.currentFrameNumber = g_frame_idx;
 			fr.safeFrameNumber = (g_frame_idx > 2) ? g_frame_idx - 2 : 0;
 
+			RIVE_PROFILE_ZONE("RenderContext::flush (D3D12)");
 			g_rive_context->flush(fr);
 		}
 
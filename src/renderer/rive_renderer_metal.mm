@@ -1,5 +1,6 @@
 #include "rive_renderer.h"
 #include "rive_render_registry.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/classes/rendering_device.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
@@ -104,6 +105,7 @@ void render_texture_metal(RenderingDevice *rd, RID texture_rid, RiveDrawable *dr
                 drawable->draw(&renderer);
             }
             
+            RIVE_PROFILE_ZONE("RenderContext::flush (Metal)");
             g_rive_context->flush(fr);
         }
         
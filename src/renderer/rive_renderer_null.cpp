@@ -0,0 +1,37 @@
+#include "rive_renderer.h"
+#include "rive_render_registry.h"
+#include "../rive_profiler.h"
+
+#include "utils/no_op_factory.hpp"
+#include "utils/no_op_renderer.hpp"
+
+namespace rive_integration {
+
+// Used by the dummy rendering driver (--headless). Files still import and artboards still
+// advance and draw, but nothing reaches a GPU, so CPU-side cost can be measured without one.
+static rive::NoOpFactory *g_null_factory = nullptr;
+
+bool create_null_context() {
+    if (!g_null_factory) {
+        g_null_factory = new rive::NoOpFactory();
+    }
+    RiveRenderRegistry::get_singleton()->set_factory(g_null_factory);
+    return true;
+}
+
+void render_texture_null(RiveDrawable *drawable) {
+    if (!drawable) return;
+
+    rive::NoOpRenderer renderer;
+    drawable->draw(&renderer);
+}
+
+void cleanup_null_context() {
+    if (RiveRenderRegistry::get_singleton()->get_factory() == g_null_factory) {
+        RiveRenderRegistry::get_singleton()->set_factory(nullptr);
+    }
+    delete g_null_factory;
+    g_null_factory = nullptr;
+}
+
+} // namespace rive_integration
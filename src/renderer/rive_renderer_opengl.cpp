@@ -1,5 +1,6 @@
 #include "rive_renderer.h"
 #include "rive_render_registry.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
@@ -98,9 +99,12 @@ void render_texture_opengl(RID texture_rid, RiveDrawable *drawable, uint32_t wid
         renderer.restore();
     }
     
-    g_rive_context->flush({
-        .renderTarget = &render_target
-    });
+    {
+        RIVE_PROFILE_ZONE("RenderContext::flush (OpenGL)");
+        g_rive_context->flush({
+            .renderTarget = &render_target
+        });
+    }
 
     gl_impl->unbindGLInternalResources();
 }
@@ -1,5 +1,6 @@
 #include "rive_renderer.h"
 #include "rive_render_registry.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/classes/rendering_device.hpp>
 #include <godot_cpp/classes/rd_texture_format.hpp>
 #include <godot_cpp/classes/rd_texture_view.hpp>
@@ -283,6 +284,7 @@ void render_texture_vulkan(RenderingDevice *rd, RID texture_rid, RiveDrawable *d
             fr.currentFrameNumber = frame_idx;
             fr.safeFrameNumber = (frame_idx > 2) ? frame_idx - 2 : 0;
 
+            RIVE_PROFILE_ZONE("RenderContext::flush (Vulkan)");
             g_rive_context->flush(fr);
         }
     }
@@ -1,5 +1,6 @@
 #include "rive_texture_factory.h"
 #include "rive_render_registry.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/rendering_device.hpp>
 #include <godot_cpp/classes/image.hpp>
@@ -21,6 +22,8 @@ namespace rive_integration {
 rive::rcp<rive::RenderImage> RiveTextureFactory::make_image(Ref<Texture2D> texture) {
     if (texture.is_null()) return nullptr;
 
+    RIVE_PROFILE_ZONE("RiveTextureFactory::make_image");
+
     auto registry = RiveRenderRegistry::get_singleton();
     if (!registry) return nullptr;
     
@@ -1,6 +1,11 @@
 #include "rive_texture_target.h"
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/rendering_device.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+void RiveTextureTarget::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("get_image"), &RiveTextureTarget::get_image);
+}
 
 RiveTextureTarget::RiveTextureTarget() {
 }
@@ -27,6 +32,7 @@ void RiveTextureTarget::clear() {
     texture_rid = RID();
     texture_rd_ref.unref();
     texture_size = Size2i();
+    texture_memory.release();
 }
 
 bool RiveTextureTarget::resize(Size2i new_size) {
@@ -76,5 +82,24 @@ bool RiveTextureTarget::resize(Size2i new_size) {
     }
     
     texture_size = new_size;
+    texture_memory.track(nullptr, RiveMemoryStats::TEXTURES, (int64_t)new_size.width * new_size.height * 4);
     return true;
 }
+
+Ref<Image> RiveTextureTarget::get_image() const {
+    if (!texture_rid.is_valid()) return Ref<Image>();
+
+    RenderingServer *rs = RenderingServer::get_singleton();
+    if (!rs) return Ref<Image>();
+
+    if (texture_rd_ref.is_valid()) {
+        RenderingDevice *rd = rs->get_rendering_device();
+        if (!rd) return Ref<Image>();
+
+        PackedByteArray pixels = rd->texture_get_data(texture_rid, 0);
+        if (pixels.is_empty()) return Ref<Image>();
+        return Image::create_from_data(texture_size.width, texture_size.height, false, Image::FORMAT_RGBA8, pixels);
+    }
+
+    return rs->texture_2d_get(texture_rid);
+}
@@ -8,6 +8,7 @@
 #include <godot_cpp/classes/rd_texture_format.hpp>
 #include <godot_cpp/classes/rd_texture_view.hpp>
 #include <godot_cpp/classes/image.hpp>
+#include "../resources/rive_memory.h"
 
 using namespace godot;
 
@@ -18,9 +19,10 @@ private:
     RID texture_rid;
     Ref<Texture2DRD> texture_rd_ref;
     Size2i texture_size;
+    RiveMemoryHandle texture_memory;
 
 protected:
-    static void _bind_methods() {}
+    static void _bind_methods();
 
 public:
     RiveTextureTarget();
@@ -34,6 +36,9 @@ public:
     Size2i get_size() const { return texture_size; }
     bool is_valid() const { return texture_rid.is_valid(); }
 
+    // Reads the texture back to the CPU. Stalls the GPU, meant for tests and tools.
+    Ref<Image> get_image() const;
+
     void clear();
 };
 
@@ -0,0 +1,18 @@
+#include "rive_artboard_handle.h"
+#include <godot_cpp/core/class_db.hpp>
+
+void RiveArtboardHandle::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("is_valid"), &RiveArtboardHandle::is_valid);
+    ClassDB::bind_method(D_METHOD("get_rive_file"), &RiveArtboardHandle::get_rive_file);
+    ClassDB::bind_method(D_METHOD("get_artboard_name"), &RiveArtboardHandle::get_artboard_name);
+    ClassDB::bind_method(D_METHOD("get_state_machine_name"), &RiveArtboardHandle::get_state_machine_name);
+    ClassDB::bind_method(D_METHOD("get_animation_name"), &RiveArtboardHandle::get_animation_name);
+}
+
+void RiveArtboardHandle::setup(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_state_machine, const String &p_animation, std::unique_ptr<RiveBundle> p_bundle) {
+    rive_file = p_file;
+    artboard_name = p_artboard;
+    state_machine_name = p_state_machine;
+    animation_name = p_animation;
+    bundle = std::move(p_bundle);
+}
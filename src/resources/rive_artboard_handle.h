@@ -0,0 +1,35 @@
+#ifndef RIVE_ARTBOARD_HANDLE_H
+#define RIVE_ARTBOARD_HANDLE_H
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include "rive_file.h"
+
+using namespace godot;
+
+// A ready to play artboard from RiveFile.instantiate_many(), waiting to be adopted by a node.
+// Adopting moves the artboard out, the handle is empty afterwards.
+class RiveArtboardHandle : public RefCounted {
+    GDCLASS(RiveArtboardHandle, RefCounted);
+
+private:
+    Ref<RiveFile> rive_file;
+    String artboard_name;
+    String state_machine_name;
+    String animation_name;
+    std::unique_ptr<RiveBundle> bundle;
+
+protected:
+    static void _bind_methods();
+
+public:
+    void setup(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_state_machine, const String &p_animation, std::unique_ptr<RiveBundle> p_bundle);
+    std::unique_ptr<RiveBundle> take_bundle() { return std::move(bundle); }
+
+    bool is_valid() const { return bundle != nullptr; }
+    Ref<RiveFile> get_rive_file() const { return rive_file; }
+    String get_artboard_name() const { return artboard_name; }
+    String get_state_machine_name() const { return state_machine_name; }
+    String get_animation_name() const { return animation_name; }
+};
+
+#endif // RIVE_ARTBOARD_HANDLE_H
@@ -0,0 +1,68 @@
+#include "rive_bundle.h"
+
+void RiveBundle::setup(rive::File *p_file, const String &p_state_machine, const String &p_animation) {
+    state_machine.reset();
+    animation.reset();
+    view_model_instance = nullptr;
+    if (!artboard) return;
+
+    artboard->advance(0.0f);
+
+    if (p_file) {
+        int view_model_id = artboard->viewModelId();
+        if (view_model_id != -1) {
+            view_model_instance = p_file->createViewModelInstance(view_model_id, 0);
+        }
+
+        if (!view_model_instance) {
+            view_model_instance = p_file->createViewModelInstance(artboard.get());
+        }
+    }
+
+    if (!p_state_machine.is_empty()) {
+        state_machine = artboard->stateMachineNamed(p_state_machine.utf8().get_data());
+    }
+
+    if (!state_machine && !p_animation.is_empty()) {
+        animation = artboard->animationNamed(p_animation.utf8().get_data());
+    }
+
+    // Fallback to defaults if nothing specified or found
+    if (!state_machine && !animation) {
+        if (artboard->stateMachineCount() > 0) {
+            state_machine = artboard->stateMachineAt(0);
+        } else if (artboard->animationCount() > 0) {
+            animation = artboard->animationAt(0);
+        }
+    }
+
+    if (view_model_instance) {
+        if (state_machine) {
+            state_machine->bindViewModelInstance(view_model_instance);
+        } else if (animation) {
+            artboard->bindViewModelInstance(view_model_instance);
+        }
+
+        artboard->advance(0.0f);
+        if (state_machine) state_machine->advance(0.0f);
+        else if (animation) animation->advance(0.0f);
+    }
+}
+
+void RiveBundle::track_memory(const std::shared_ptr<RiveMemoryStats> &p_stats) {
+    if (artboard) {
+        artboard_memory.track(p_stats, RiveMemoryStats::ARTBOARDS, rive_memory::estimate_artboard(artboard.get()));
+    }
+    if (state_machine) {
+        state_machine_memory.track(p_stats, RiveMemoryStats::STATE_MACHINES, rive_memory::estimate_state_machine(state_machine.get()));
+    }
+    if (view_model_instance) {
+        view_model_memory.track(p_stats, RiveMemoryStats::VIEW_MODELS, rive_memory::estimate_view_model(view_model_instance.get()));
+    }
+}
+
+void RiveBundle::release_memory() {
+    artboard_memory.release();
+    state_machine_memory.release();
+    view_model_memory.release();
+}
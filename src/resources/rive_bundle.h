@@ -0,0 +1,38 @@
+#ifndef RIVE_BUNDLE_H
+#define RIVE_BUNDLE_H
+
+#include <godot_cpp/variant/string.hpp>
+#include <rive/file.hpp>
+#include <rive/artboard.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/viewmodel/viewmodel_instance.hpp>
+#include "rive_memory.h"
+#include <memory>
+
+using namespace godot;
+
+// Everything a player runs: an artboard instance, the state machine (or linear animation)
+// driving it and its default view model instance, bound and advanced to the first frame.
+// Declared so the artboard is destroyed last.
+struct RiveBundle {
+    std::unique_ptr<rive::ArtboardInstance> artboard;
+    std::unique_ptr<rive::StateMachineInstance> state_machine;
+    std::unique_ptr<rive::LinearAnimationInstance> animation;
+    rive::rcp<rive::ViewModelInstance> view_model_instance;
+
+    // Charges for the contents while the bundle sits in a pool or an RiveArtboardHandle.
+    // A player adopting the bundle releases them and tracks what it runs itself.
+    RiveMemoryHandle artboard_memory;
+    RiveMemoryHandle state_machine_memory;
+    RiveMemoryHandle view_model_memory;
+
+    // Picks p_state_machine, else p_animation, else the first state machine or animation.
+    // p_file may be null (SVG artboards), then no view model is created. p_file is only read,
+    // so bundles of one file can be set up on several threads at once.
+    void setup(rive::File *p_file, const String &p_state_machine, const String &p_animation);
+    void track_memory(const std::shared_ptr<RiveMemoryStats> &p_stats);
+    void release_memory();
+};
+
+#endif // RIVE_BUNDLE_H
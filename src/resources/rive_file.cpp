@@ -1,10 +1,20 @@
 #include "rive_file.h"
+#include "rive_artboard_handle.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 void RiveFile::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_data", "data"), &RiveFile::set_data);
     ClassDB::bind_method(D_METHOD("get_data"), &RiveFile::get_data);
+    ClassDB::bind_method(D_METHOD("get_artboard_names"), &RiveFile::get_artboard_names);
+    ClassDB::bind_method(D_METHOD("get_memory_usage"), &RiveFile::get_memory_usage);
+    ClassDB::bind_method(D_METHOD("prewarm", "artboard", "count", "state_machine", "animation"), &RiveFile::prewarm, DEFVAL(""), DEFVAL(""));
+    ClassDB::bind_method(D_METHOD("instantiate_many", "artboard", "count", "state_machine", "animation"), &RiveFile::instantiate_many, DEFVAL(""), DEFVAL(""));
+    ClassDB::bind_method(D_METHOD("get_pooled_count", "artboard", "state_machine", "animation"), &RiveFile::get_pooled_count, DEFVAL(""), DEFVAL(""));
+    ClassDB::bind_method(D_METHOD("clear_pool"), &RiveFile::clear_pool);
+    ClassDB::bind_static_method("RiveFile", D_METHOD("get_global_memory_usage"), &RiveFile::get_global_memory_usage);
 
     ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_STORAGE), "set_data", "get_data");
 }
@@ -12,17 +22,22 @@ void RiveFile::_bind_methods() {
 RiveFile::RiveFile() {}
 
 RiveFile::~RiveFile() {
+    clear_pool();
     rive_file.reset();
+    asset_memory.clear();
     rive_svg.unref();
 }
 
 void RiveFile::set_data(const PackedByteArray &p_data) {
+    clear_pool();
     data = p_data;
     // FIXME: In editor, we might want to load immediately to check validity, 
     // but usually we load on demand or when the resource is loaded.
     // For now, reload will lead to crash.
     rive_file.reset();
+    asset_memory.clear();
     rive_svg.unref();
+    data_memory.track(memory_stats, RiveMemoryStats::FILE_DATA, data.size());
 }
 
 PackedByteArray RiveFile::get_data() const {
@@ -33,6 +48,8 @@ Error RiveFile::load_rive_file() {
     if (rive_file || rive_svg.is_valid()) return OK;
     if (data.is_empty()) return ERR_INVALID_DATA;
 
+    RIVE_PROFILE_ZONE("RiveFile::load_rive_file");
+
     // FIXME: Hardcoded check if it's SVG.
     String signature = "";
     if (data.size() > 10) {
@@ -59,7 +76,7 @@ Error RiveFile::load_rive_file() {
 
     rive::Span<const uint8_t> bytes(data.ptr(), data.size());
     rive::ImportResult result;
-    rive_file = rive::File::import(bytes, factory, &result);
+    rive_file = rive_memory::import_file(bytes, factory, &result, memory_stats, asset_memory);
 
     if (!rive_file) {
         UtilityFunctions::printerr("Failed to import Rive file. Result: ", (int)result);
@@ -101,3 +118,255 @@ std::unique_ptr<rive::ArtboardInstance> RiveFile::instantiate_artboard(String na
     
     return artboard;
 }
+
+String RiveFile::_pool_key(const String &p_artboard, const String &p_state_machine, const String &p_animation) {
+    return p_artboard + "/" + p_state_machine + "/" + p_animation;
+}
+
+std::unique_ptr<RiveBundle> RiveFile::create_bundle(const String &p_artboard, const String &p_state_machine, const String &p_animation) {
+    std::unique_ptr<RiveBundle> bundle = std::make_unique<RiveBundle>();
+    bundle->artboard = instantiate_artboard(p_artboard);
+    if (!bundle->artboard) return nullptr;
+
+    bundle->setup(rive_file.get(), p_state_machine, p_animation);
+    // Counted from here, so prewarmed pools show up in the memory monitors.
+    bundle->track_memory(memory_stats);
+    return bundle;
+}
+
+std::unique_ptr<RiveBundle> RiveFile::acquire_bundle(const String &p_artboard, const String &p_state_machine, const String &p_animation) {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        HashMap<String, BundlePool *>::Iterator it = pools.find(_pool_key(p_artboard, p_state_machine, p_animation));
+        if (it != pools.end() && !it->value->ready.empty()) {
+            std::unique_ptr<RiveBundle> bundle = std::move(it->value->ready.back());
+            it->value->ready.pop_back();
+            return bundle;
+        }
+    }
+    return create_bundle(p_artboard, p_state_machine, p_animation);
+}
+
+void RiveFile::release_bundle(const String &p_artboard, const String &p_state_machine, const String &p_animation, std::unique_ptr<RiveBundle> p_bundle) {
+    if (!p_bundle) return;
+
+    String key = _pool_key(p_artboard, p_state_machine, p_animation);
+    if (file_type == TYPE_SVG) {
+        // RiveSVG isn't meant to be shared across threads (see _create_bundles), so SVG pools
+        // are refilled here on the caller's thread instead of by _recycle_task.
+        p_bundle.reset();
+        bool refill = false;
+        {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            HashMap<String, BundlePool *>::Iterator it = pools.find(key);
+            refill = it != pools.end() && (int)it->value->ready.size() < it->value->target;
+        }
+        if (!refill) return;
+
+        std::unique_ptr<RiveBundle> fresh = create_bundle(p_artboard, p_state_machine, p_animation);
+        if (!fresh) return;
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        HashMap<String, BundlePool *>::Iterator it = pools.find(key);
+        if (it != pools.end()) {
+            it->value->ready.push_back(std::move(fresh));
+        }
+        return;
+    }
+
+    bool start_task = false;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        // Nothing to refill, let the bundle go like before pooling existed.
+        if (!pools.has(key)) return;
+
+        recycle_queue.push_back(RecycleEntry{ key, std::move(p_bundle) });
+        if (!recycle_running) {
+            recycle_running = true;
+            start_task = true;
+        }
+    }
+
+    if (start_task) {
+        WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+        // The previous task has already left its loop, collect it before starting another.
+        if (recycle_task_id != -1) {
+            pool->wait_for_task_completion(recycle_task_id);
+        }
+        recycle_task_id = pool->add_native_task(&RiveFile::_recycle_task, this, false, "RiveFile Recycle Bundles");
+    }
+}
+
+// Drains recycle_queue: destroys each released bundle and tops its pool up with a fresh one.
+// Never used for SVG files, see release_bundle().
+void RiveFile::_recycle_task(void *p_userdata) {
+    RiveFile *file = static_cast<RiveFile *>(p_userdata);
+    RIVE_PROFILE_ZONE("RiveFile::recycle_bundles");
+
+    while (true) {
+        RecycleEntry entry;
+        String artboard, state_machine, animation;
+        bool refill = false;
+        {
+            std::lock_guard<std::mutex> lock(file->pool_mutex);
+            if (file->recycle_queue.empty()) {
+                file->recycle_running = false;
+                return;
+            }
+            entry = std::move(file->recycle_queue.back());
+            file->recycle_queue.pop_back();
+
+            HashMap<String, BundlePool *>::Iterator it = file->pools.find(entry.key);
+            if (it != file->pools.end() && (int)it->value->ready.size() < it->value->target) {
+                refill = true;
+                artboard = it->value->artboard;
+                state_machine = it->value->state_machine;
+                animation = it->value->animation;
+            }
+        }
+
+        entry.bundle.reset();
+        if (!refill) continue;
+
+        std::unique_ptr<RiveBundle> fresh = file->create_bundle(artboard, state_machine, animation);
+        if (!fresh) continue;
+
+        std::lock_guard<std::mutex> lock(file->pool_mutex);
+        HashMap<String, BundlePool *>::Iterator it = file->pools.find(entry.key);
+        if (it != file->pools.end()) {
+            it->value->ready.push_back(std::move(fresh));
+        }
+    }
+}
+
+void RiveFile::_wait_for_recycling() {
+    if (recycle_task_id == -1) return;
+    WorkerThreadPool::get_singleton()->wait_for_task_completion(recycle_task_id);
+    recycle_task_id = -1;
+}
+
+// Fills the pool for this artboard/state machine/animation up to p_count ready bundles, and keeps
+// it there as bundles are released. Meant for loading screens.
+Error RiveFile::prewarm(const String &p_artboard, int p_count, const String &p_state_machine, const String &p_animation) {
+    ERR_FAIL_COND_V(p_count < 0, ERR_INVALID_PARAMETER);
+    RIVE_PROFILE_ZONE("RiveFile::prewarm");
+    Error err = load_rive_file();
+    if (err != OK) return err;
+
+    String key = _pool_key(p_artboard, p_state_machine, p_animation);
+    int missing = 0;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        HashMap<String, BundlePool *>::Iterator it = pools.find(key);
+        if (it == pools.end()) {
+            BundlePool *pool = new BundlePool();
+            pool->artboard = p_artboard;
+            pool->state_machine = p_state_machine;
+            pool->animation = p_animation;
+            it = pools.insert(key, pool);
+        }
+        it->value->target = MAX(it->value->target, p_count);
+        missing = p_count - (int)it->value->ready.size();
+    }
+
+    if (missing <= 0) return OK;
+
+    std::vector<std::unique_ptr<RiveBundle>> bundles;
+    _create_bundles(p_artboard, p_state_machine, p_animation, missing, bundles);
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    BundlePool *pool = pools[key];
+    for (std::unique_ptr<RiveBundle> &bundle : bundles) {
+        ERR_FAIL_COND_V_MSG(!bundle, ERR_CANT_CREATE, "RiveFile: Could not instantiate artboard for the pool.");
+        pool->ready.push_back(std::move(bundle));
+    }
+    return OK;
+}
+
+// Builds p_count artboards in parallel and returns them as RiveArtboardHandles for
+// RiveFileInstance.adopt_artboard(). Shortens level loads that spawn many instances at once.
+Array RiveFile::instantiate_many(const String &p_artboard, int p_count, const String &p_state_machine, const String &p_animation) {
+    Array handles;
+    ERR_FAIL_COND_V(p_count < 0, handles);
+    RIVE_PROFILE_ZONE("RiveFile::instantiate_many");
+    if (load_rive_file() != OK) return handles;
+
+    std::vector<std::unique_ptr<RiveBundle>> bundles;
+    _create_bundles(p_artboard, p_state_machine, p_animation, p_count, bundles);
+
+    Ref<RiveFile> self(this);
+    for (std::unique_ptr<RiveBundle> &bundle : bundles) {
+        ERR_CONTINUE_MSG(!bundle, "RiveFile: Could not instantiate artboard.");
+        Ref<RiveArtboardHandle> handle;
+        handle.instantiate();
+        handle->setup(self, p_artboard, p_state_machine, p_animation, std::move(bundle));
+        handles.push_back(handle);
+    }
+    return handles;
+}
+
+// One artboard per call. rive::File is immutable after import and instancing only reads it,
+// so these run concurrently without locking.
+void RiveFile::_create_bundle_task(void *p_userdata, uint32_t p_index) {
+    BundleBatch *batch = static_cast<BundleBatch *>(p_userdata);
+    (*batch->bundles)[p_index] = batch->file->create_bundle(batch->artboard, batch->state_machine, batch->animation);
+}
+
+void RiveFile::_create_bundles(const String &p_artboard, const String &p_state_machine, const String &p_animation, int p_count, std::vector<std::unique_ptr<RiveBundle>> &r_bundles) {
+    r_bundles.clear();
+    r_bundles.resize(p_count);
+
+    BundleBatch batch;
+    batch.file = this;
+    batch.artboard = p_artboard;
+    batch.state_machine = p_state_machine;
+    batch.animation = p_animation;
+    batch.bundles = &r_bundles;
+
+    // SVG artboards are built by RiveSVG, which isn't meant to be shared across threads.
+    if (p_count == 1 || file_type == TYPE_SVG) {
+        for (int i = 0; i < p_count; i++) {
+            _create_bundle_task(&batch, i);
+        }
+    } else if (p_count > 1) {
+        WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+        int64_t group_id = pool->add_native_group_task(&RiveFile::_create_bundle_task, &batch, p_count, -1, true, "RiveFile Instantiate");
+        pool->wait_for_group_task_completion(group_id);
+    }
+}
+
+int RiveFile::get_pooled_count(const String &p_artboard, const String &p_state_machine, const String &p_animation) {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    HashMap<String, BundlePool *>::Iterator it = pools.find(_pool_key(p_artboard, p_state_machine, p_animation));
+    return it != pools.end() ? (int)it->value->ready.size() : 0;
+}
+
+void RiveFile::clear_pool() {
+    _wait_for_recycling();
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    recycle_queue.clear();
+    for (KeyValue<String, BundlePool *> &E : pools) {
+        delete E.value;
+    }
+    pools.clear();
+}
+
+PackedStringArray RiveFile::get_artboard_names() {
+    PackedStringArray names;
+    rive::File *file = get_rive_file();
+    if (file) {
+        for (size_t i = 0; i < file->artboardCount(); i++) {
+            rive::Artboard *artboard = file->artboard(i);
+            if (artboard) names.push_back(String(artboard->name().c_str()));
+        }
+    }
+    return names;
+}
+
+Dictionary RiveFile::get_memory_usage() const {
+    return memory_stats->to_dictionary();
+}
+
+Dictionary RiveFile::get_global_memory_usage() {
+    return RiveMemoryStats::get_global().to_dictionary();
+}
@@ -3,10 +3,14 @@
 
 #include <godot_cpp/classes/resource.hpp>
 #include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 #include "rive/file.hpp"
 #include "rive/artboard.hpp"
 #include "../renderer/rive_render_registry.h"
 #include "../rive_svg.h"
+#include "rive_memory.h"
+#include "rive_bundle.h"
+#include <mutex>
 
 using namespace godot;
 
@@ -25,6 +29,45 @@ private:
     Ref<RiveSVG> rive_svg;
     Type file_type = TYPE_RIVE;
 
+    std::shared_ptr<RiveMemoryStats> memory_stats = std::make_shared<RiveMemoryStats>();
+    RiveMemoryHandle data_memory;
+    std::vector<RiveMemoryHandle> asset_memory;
+
+    // Ready bundles per artboard/state machine/animation, see prewarm(). Released bundles can't
+    // be rewound (state machines have no reset), so a worker destroys them and builds fresh
+    // replacements until the pool is back at its target. pool_mutex guards pools and recycle_queue.
+    struct BundlePool {
+        std::vector<std::unique_ptr<RiveBundle>> ready;
+        int target = 0;
+        String artboard;
+        String state_machine;
+        String animation;
+    };
+    struct RecycleEntry {
+        String key;
+        std::unique_ptr<RiveBundle> bundle;
+    };
+    std::mutex pool_mutex;
+    HashMap<String, BundlePool *> pools;
+    std::vector<RecycleEntry> recycle_queue;
+    bool recycle_running = false;
+    int64_t recycle_task_id = -1;
+
+    struct BundleBatch {
+        RiveFile *file = nullptr;
+        String artboard;
+        String state_machine;
+        String animation;
+        std::vector<std::unique_ptr<RiveBundle>> *bundles = nullptr;
+    };
+
+    static String _pool_key(const String &p_artboard, const String &p_state_machine, const String &p_animation);
+    static void _create_bundle_task(void *p_userdata, uint32_t p_index);
+    // Fills r_bundles with p_count bundles, in parallel for .riv files. Failed ones stay null.
+    void _create_bundles(const String &p_artboard, const String &p_state_machine, const String &p_animation, int p_count, std::vector<std::unique_ptr<RiveBundle>> &r_bundles);
+    static void _recycle_task(void *p_userdata);
+    void _wait_for_recycling();
+
 protected:
     static void _bind_methods();
 
@@ -39,6 +82,24 @@ public:
     rive::File* get_rive_file();
     
     std::unique_ptr<rive::ArtboardInstance> instantiate_artboard(String name = "");
+    PackedStringArray get_artboard_names();
+
+    // Builds a bundle, safe to call from worker threads once the file is loaded.
+    std::unique_ptr<RiveBundle> create_bundle(const String &p_artboard, const String &p_state_machine = "", const String &p_animation = "");
+    // Takes a pooled bundle, or builds one when the pool is empty.
+    std::unique_ptr<RiveBundle> acquire_bundle(const String &p_artboard, const String &p_state_machine = "", const String &p_animation = "");
+    // Returns a bundle from acquire_bundle() once its user is done with it.
+    void release_bundle(const String &p_artboard, const String &p_state_machine, const String &p_animation, std::unique_ptr<RiveBundle> p_bundle);
+
+    Error prewarm(const String &p_artboard, int p_count, const String &p_state_machine = "", const String &p_animation = "");
+    Array instantiate_many(const String &p_artboard, int p_count, const String &p_state_machine = "", const String &p_animation = "");
+    int get_pooled_count(const String &p_artboard, const String &p_state_machine = "", const String &p_animation = "");
+    void clear_pool();
+
+    // Shared with every player and node instantiated from this file.
+    const std::shared_ptr<RiveMemoryStats> &get_memory_stats() const { return memory_stats; }
+    Dictionary get_memory_usage() const;
+    static Dictionary get_global_memory_usage();
 };
 
 #endif // RIVE_FILE_H
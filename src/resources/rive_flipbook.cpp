@@ -0,0 +1,268 @@
+#include "rive_flipbook.h"
+#include "../renderer/rive_renderer.h"
+#include "../renderer/rive_texture_target.h"
+#include "../rive_profiler.h"
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/atlas_texture.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <rive/animation/linear_animation.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/animation/loop.hpp>
+
+// Largest atlas side the baker will produce.
+static const int MAX_ATLAS_SIZE = 16384;
+// Transparent gap between frames, keeps filtering from bleeding neighbours in.
+static const int FRAME_PADDING = 2;
+
+void RiveFlipbook::_bind_methods() {
+    ClassDB::bind_static_method("RiveFlipbook", D_METHOD("bake_animation", "file", "artboard", "animation", "fps", "scale"), &RiveFlipbook::bake_animation, DEFVAL(24.0f), DEFVAL(1.0f));
+    ClassDB::bind_static_method("RiveFlipbook", D_METHOD("bake_state_machine", "file", "artboard", "state_machine", "duration", "fps", "scale"), &RiveFlipbook::bake_state_machine, DEFVAL(24.0f), DEFVAL(1.0f));
+
+    ClassDB::bind_method(D_METHOD("set_atlas", "atlas"), &RiveFlipbook::set_atlas);
+    ClassDB::bind_method(D_METHOD("get_atlas"), &RiveFlipbook::get_atlas);
+    ClassDB::bind_method(D_METHOD("set_frame_size", "size"), &RiveFlipbook::set_frame_size);
+    ClassDB::bind_method(D_METHOD("get_frame_size"), &RiveFlipbook::get_frame_size);
+    ClassDB::bind_method(D_METHOD("set_frame_count", "count"), &RiveFlipbook::set_frame_count);
+    ClassDB::bind_method(D_METHOD("get_frame_count"), &RiveFlipbook::get_frame_count);
+    ClassDB::bind_method(D_METHOD("set_columns", "columns"), &RiveFlipbook::set_columns);
+    ClassDB::bind_method(D_METHOD("get_columns"), &RiveFlipbook::get_columns);
+    ClassDB::bind_method(D_METHOD("set_padding", "padding"), &RiveFlipbook::set_padding);
+    ClassDB::bind_method(D_METHOD("get_padding"), &RiveFlipbook::get_padding);
+    ClassDB::bind_method(D_METHOD("set_fps", "fps"), &RiveFlipbook::set_fps);
+    ClassDB::bind_method(D_METHOD("get_fps"), &RiveFlipbook::get_fps);
+    ClassDB::bind_method(D_METHOD("set_loop", "loop"), &RiveFlipbook::set_loop);
+    ClassDB::bind_method(D_METHOD("get_loop"), &RiveFlipbook::get_loop);
+    ClassDB::bind_method(D_METHOD("set_scale", "scale"), &RiveFlipbook::set_scale);
+    ClassDB::bind_method(D_METHOD("get_scale"), &RiveFlipbook::get_scale);
+    ClassDB::bind_method(D_METHOD("set_origin", "origin"), &RiveFlipbook::set_origin);
+    ClassDB::bind_method(D_METHOD("get_origin"), &RiveFlipbook::get_origin);
+
+    ClassDB::bind_method(D_METHOD("get_frame_rect", "frame"), &RiveFlipbook::get_frame_rect);
+    ClassDB::bind_method(D_METHOD("to_sprite_frames", "animation"), &RiveFlipbook::to_sprite_frames, DEFVAL("default"));
+
+    ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "atlas", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"), "set_atlas", "get_atlas");
+    ADD_PROPERTY(PropertyInfo(Variant::VECTOR2I, "frame_size"), "set_frame_size", "get_frame_size");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "frame_count"), "set_frame_count", "get_frame_count");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "columns"), "set_columns", "get_columns");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "padding"), "set_padding", "get_padding");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fps"), "set_fps", "get_fps");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "get_loop");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scale"), "set_scale", "get_scale");
+    ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "origin"), "set_origin", "get_origin");
+}
+
+namespace {
+
+// Draws the artboard scaled so its bounds fill the frame.
+struct FlipbookDrawable : public RiveDrawable {
+    rive::ArtboardInstance *artboard = nullptr;
+    float scale = 1.0f;
+
+    void draw(rive::Renderer *renderer) override {
+        rive::AABB aabb = artboard->bounds();
+        renderer->transform(rive::Mat2D(scale, 0.0f, 0.0f, scale, -aabb.minX * scale, -aabb.minY * scale));
+        artboard->draw(renderer);
+    }
+};
+
+}
+
+Ref<RiveFlipbook> RiveFlipbook::bake_animation(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_animation, float p_fps, float p_scale) {
+    return _bake(p_file, p_artboard, p_animation, String(), 0.0f, p_fps, p_scale);
+}
+
+Ref<RiveFlipbook> RiveFlipbook::bake_state_machine(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_state_machine, float p_duration, float p_fps, float p_scale) {
+    ERR_FAIL_COND_V_MSG(p_duration <= 0.0f, Ref<RiveFlipbook>(), "RiveFlipbook: State machine bakes need a positive duration.");
+    return _bake(p_file, p_artboard, String(), p_state_machine, p_duration, p_fps, p_scale);
+}
+
+// Renders every frame into one target and reads it back, so this stalls the GPU once per frame.
+// Meant for load screens and tools, not for per-frame use.
+Ref<RiveFlipbook> RiveFlipbook::_bake(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_animation, const String &p_state_machine, float p_duration, float p_fps, float p_scale) {
+    RIVE_PROFILE_ZONE("RiveFlipbook::bake");
+    ERR_FAIL_COND_V(p_file.is_null(), Ref<RiveFlipbook>());
+    ERR_FAIL_COND_V_MSG(p_fps <= 0.0f || p_scale <= 0.0f, Ref<RiveFlipbook>(), "RiveFlipbook: fps and scale must be positive.");
+
+    std::unique_ptr<rive::ArtboardInstance> artboard = p_file->instantiate_artboard(p_artboard);
+    ERR_FAIL_COND_V_MSG(!artboard, Ref<RiveFlipbook>(), "RiveFlipbook: Could not instantiate artboard.");
+
+    bool use_state_machine = p_duration > 0.0f;
+    std::unique_ptr<rive::StateMachineInstance> state_machine;
+    std::unique_ptr<rive::LinearAnimationInstance> animation;
+    float start = 0.0f;
+    float duration = p_duration;
+    bool loop = true;
+    if (use_state_machine) {
+        state_machine = p_state_machine.is_empty() ? artboard->stateMachineAt(0) : artboard->stateMachineNamed(p_state_machine.utf8().get_data());
+        ERR_FAIL_COND_V_MSG(!state_machine, Ref<RiveFlipbook>(), "RiveFlipbook: State machine not found: " + p_state_machine);
+    } else {
+        animation = p_animation.is_empty() ? artboard->animationAt(0) : artboard->animationNamed(p_animation.utf8().get_data());
+        ERR_FAIL_COND_V_MSG(!animation, Ref<RiveFlipbook>(), "RiveFlipbook: Animation not found: " + p_animation);
+        start = animation->animation()->startSeconds();
+        duration = animation->animation()->durationSeconds();
+        loop = animation->animation()->loopValue() != (int)rive::Loop::oneShot;
+    }
+
+    // A loop's last frame is its first again. One shots keep theirs so they end on the final pose.
+    int frame_count = MAX(1, (int)Math::ceil(duration * p_fps - 0.001f));
+    if (!loop) {
+        frame_count++;
+    }
+
+    rive::AABB aabb = artboard->bounds();
+    Vector2i frame_size(MAX(1, (int)Math::ceil(aabb.width() * p_scale)), MAX(1, (int)Math::ceil(aabb.height() * p_scale)));
+    int columns = MAX(1, (int)Math::ceil(Math::sqrt((double)frame_count)));
+    int rows = (frame_count + columns - 1) / columns;
+    Vector2i atlas_size(columns * (frame_size.x + FRAME_PADDING) - FRAME_PADDING, rows * (frame_size.y + FRAME_PADDING) - FRAME_PADDING);
+    ERR_FAIL_COND_V_MSG(atlas_size.x > MAX_ATLAS_SIZE || atlas_size.y > MAX_ATLAS_SIZE, Ref<RiveFlipbook>(), "RiveFlipbook: Atlas would exceed 16384 pixels, lower fps or scale.");
+
+    RenderingServer *rs = RenderingServer::get_singleton();
+    ERR_FAIL_NULL_V(rs, Ref<RiveFlipbook>());
+
+    Ref<RiveFlipbook> flipbook;
+    flipbook.instantiate();
+    flipbook->frame_size = frame_size;
+    flipbook->frame_count = frame_count;
+    flipbook->columns = columns;
+    flipbook->padding = FRAME_PADDING;
+    flipbook->fps = p_fps;
+    flipbook->loop = loop;
+    flipbook->scale = p_scale;
+    flipbook->origin = Vector2(-aabb.minX, -aabb.minY) * p_scale;
+
+    Ref<Image> atlas_image = Image::create_empty(atlas_size.x, atlas_size.y, false, Image::FORMAT_RGBA8);
+    Ref<RiveTextureTarget> target;
+    target.instantiate();
+    target->resize(frame_size);
+
+    FlipbookDrawable drawable;
+    drawable.artboard = artboard.get();
+    drawable.scale = p_scale;
+
+    float step = 1.0f / p_fps;
+    for (int i = 0; i < frame_count; i++) {
+        float delta = i == 0 ? 0.0f : step;
+        if (state_machine) {
+            state_machine->advance(delta);
+        } else {
+            animation->time(start + i * step);
+            animation->apply();
+        }
+        artboard->advance(delta);
+
+        rive_integration::render_texture(rs->get_rendering_device(), target->get_texture_rid(), &drawable, frame_size.x, frame_size.y);
+        Ref<Image> frame = target->get_image();
+        ERR_FAIL_COND_V_MSG(frame.is_null(), Ref<RiveFlipbook>(), "RiveFlipbook: Could not read back the rendered frame.");
+        if (frame->get_format() != Image::FORMAT_RGBA8) {
+            frame->convert(Image::FORMAT_RGBA8);
+        }
+        atlas_image->blit_rect(frame, Rect2i(Vector2i(), frame_size), flipbook->get_frame_rect(i).position);
+    }
+
+    flipbook->atlas = ImageTexture::create_from_image(atlas_image);
+    return flipbook;
+}
+
+void RiveFlipbook::set_atlas(const Ref<Texture2D> &p_atlas) {
+    atlas = p_atlas;
+}
+
+Ref<Texture2D> RiveFlipbook::get_atlas() const {
+    return atlas;
+}
+
+void RiveFlipbook::set_frame_size(const Vector2i &p_size) {
+    frame_size = p_size;
+}
+
+Vector2i RiveFlipbook::get_frame_size() const {
+    return frame_size;
+}
+
+void RiveFlipbook::set_frame_count(int p_count) {
+    frame_count = MAX(0, p_count);
+}
+
+int RiveFlipbook::get_frame_count() const {
+    return frame_count;
+}
+
+void RiveFlipbook::set_columns(int p_columns) {
+    columns = MAX(1, p_columns);
+}
+
+int RiveFlipbook::get_columns() const {
+    return columns;
+}
+
+void RiveFlipbook::set_padding(int p_padding) {
+    padding = MAX(0, p_padding);
+}
+
+int RiveFlipbook::get_padding() const {
+    return padding;
+}
+
+void RiveFlipbook::set_fps(float p_fps) {
+    fps = p_fps;
+}
+
+float RiveFlipbook::get_fps() const {
+    return fps;
+}
+
+void RiveFlipbook::set_loop(bool p_loop) {
+    loop = p_loop;
+}
+
+bool RiveFlipbook::get_loop() const {
+    return loop;
+}
+
+void RiveFlipbook::set_scale(float p_scale) {
+    scale = p_scale;
+}
+
+float RiveFlipbook::get_scale() const {
+    return scale;
+}
+
+void RiveFlipbook::set_origin(const Vector2 &p_origin) {
+    origin = p_origin;
+}
+
+Vector2 RiveFlipbook::get_origin() const {
+    return origin;
+}
+
+Rect2i RiveFlipbook::get_frame_rect(int p_frame) const {
+    ERR_FAIL_INDEX_V(p_frame, frame_count, Rect2i());
+    int column = p_frame % columns;
+    int row = p_frame / columns;
+    return Rect2i(column * (frame_size.x + padding), row * (frame_size.y + padding), frame_size.x, frame_size.y);
+}
+
+// One AtlasTexture per frame, ready for AnimatedSprite2D.
+Ref<SpriteFrames> RiveFlipbook::to_sprite_frames(const StringName &p_animation) const {
+    ERR_FAIL_COND_V(atlas.is_null(), Ref<SpriteFrames>());
+
+    Ref<SpriteFrames> frames;
+    frames.instantiate();
+    if (!frames->has_animation(p_animation)) {
+        frames->add_animation(p_animation);
+    }
+    frames->set_animation_speed(p_animation, fps);
+    frames->set_animation_loop(p_animation, loop);
+
+    for (int i = 0; i < frame_count; i++) {
+        Ref<AtlasTexture> frame;
+        frame.instantiate();
+        frame->set_atlas(atlas);
+        frame->set_region(Rect2(get_frame_rect(i)));
+        frames->add_frame(p_animation, frame);
+    }
+    return frames;
+}
@@ -0,0 +1,62 @@
+#ifndef RIVE_FLIPBOOK_H
+#define RIVE_FLIPBOOK_H
+
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/classes/sprite_frames.hpp>
+#include "rive_file.h"
+
+using namespace godot;
+
+// A linear animation or state machine sampled at a fixed rate into a sprite sheet.
+// Frames are laid out row by row, `columns` per row, `frame_size` each, `padding` pixels apart.
+class RiveFlipbook : public Resource {
+    GDCLASS(RiveFlipbook, Resource);
+
+private:
+    Ref<Texture2D> atlas;
+    Vector2i frame_size;
+    int frame_count = 0;
+    int columns = 1;
+    int padding = 0;
+    float fps = 24.0f;
+    bool loop = true;
+    // Artboard units -> pixels, and where the artboard origin lands in a frame.
+    float scale = 1.0f;
+    Vector2 origin;
+
+    static Ref<RiveFlipbook> _bake(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_animation, const String &p_state_machine, float p_duration, float p_fps, float p_scale);
+
+protected:
+    static void _bind_methods();
+
+public:
+    // Samples one pass of p_animation (the artboard's first animation if empty).
+    static Ref<RiveFlipbook> bake_animation(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_animation, float p_fps = 24.0f, float p_scale = 1.0f);
+    // Runs p_state_machine (the first one if empty) without input for p_duration seconds.
+    static Ref<RiveFlipbook> bake_state_machine(const Ref<RiveFile> &p_file, const String &p_artboard, const String &p_state_machine, float p_duration, float p_fps = 24.0f, float p_scale = 1.0f);
+
+    void set_atlas(const Ref<Texture2D> &p_atlas);
+    Ref<Texture2D> get_atlas() const;
+    void set_frame_size(const Vector2i &p_size);
+    Vector2i get_frame_size() const;
+    void set_frame_count(int p_count);
+    int get_frame_count() const;
+    void set_columns(int p_columns);
+    int get_columns() const;
+    void set_padding(int p_padding);
+    int get_padding() const;
+    void set_fps(float p_fps);
+    float get_fps() const;
+    void set_loop(bool p_loop);
+    bool get_loop() const;
+    void set_scale(float p_scale);
+    float get_scale() const;
+    void set_origin(const Vector2 &p_origin);
+    Vector2 get_origin() const;
+
+    Rect2i get_frame_rect(int p_frame) const;
+    Ref<SpriteFrames> to_sprite_frames(const StringName &p_animation = "default") const;
+};
+
+#endif // RIVE_FLIPBOOK_H
@@ -0,0 +1,156 @@
+#include "rive_memory.h"
+#include "rive/file_asset_loader.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "rive/assets/font_asset.hpp"
+#include "rive/renderer.hpp"
+
+// Runtime objects are allocated individually and vary in size, this is a rough average.
+static const int64_t ESTIMATED_BYTES_PER_OBJECT = 128;
+
+RiveMemoryStats &RiveMemoryStats::get_global() {
+    static RiveMemoryStats global;
+    return global;
+}
+
+const char *RiveMemoryStats::get_category_name(Category p_category) {
+    switch (p_category) {
+        case FILE_DATA: return "file_data";
+        case DECODED_IMAGES: return "decoded_images";
+        case FONTS: return "fonts";
+        case ARTBOARDS: return "artboards";
+        case STATE_MACHINES: return "state_machines";
+        case VIEW_MODELS: return "view_models";
+        case TEXTURES: return "textures";
+        default: return "unknown";
+    }
+}
+
+void RiveMemoryStats::add(Category p_category, int64_t p_bytes, int64_t p_count) {
+    bytes[p_category].fetch_add(p_bytes, std::memory_order_relaxed);
+    counts[p_category].fetch_add(p_count, std::memory_order_relaxed);
+}
+
+int64_t RiveMemoryStats::get_total_bytes() const {
+    int64_t total = 0;
+    for (int i = 0; i < CATEGORY_MAX; i++) {
+        total += get_bytes((Category)i);
+    }
+    return total;
+}
+
+Dictionary RiveMemoryStats::to_dictionary() const {
+    Dictionary dict;
+    for (int i = 0; i < CATEGORY_MAX; i++) {
+        String name = get_category_name((Category)i);
+        dict[name] = get_bytes((Category)i);
+        dict[name + "_count"] = get_count((Category)i);
+    }
+    dict["total"] = get_total_bytes();
+    return dict;
+}
+
+RiveMemoryHandle::RiveMemoryHandle(RiveMemoryHandle &&p_other) noexcept {
+    *this = std::move(p_other);
+}
+
+RiveMemoryHandle &RiveMemoryHandle::operator=(RiveMemoryHandle &&p_other) noexcept {
+    if (this != &p_other) {
+        release();
+        stats = std::move(p_other.stats);
+        category = p_other.category;
+        bytes = p_other.bytes;
+        active = p_other.active;
+        p_other.bytes = 0;
+        p_other.active = false;
+    }
+    return *this;
+}
+
+void RiveMemoryHandle::track(const std::shared_ptr<RiveMemoryStats> &p_stats, RiveMemoryStats::Category p_category, int64_t p_bytes) {
+    release();
+    stats = p_stats;
+    category = p_category;
+    bytes = p_bytes;
+    active = true;
+
+    if (stats) stats->add(category, bytes, 1);
+    RiveMemoryStats::get_global().add(category, bytes, 1);
+}
+
+void RiveMemoryHandle::release() {
+    if (!active) return;
+
+    if (stats) stats->add(category, -bytes, -1);
+    RiveMemoryStats::get_global().add(category, -bytes, -1);
+
+    stats.reset();
+    bytes = 0;
+    active = false;
+}
+
+namespace rive_memory {
+
+namespace {
+
+// Leaves decoding to the runtime, it only remembers which assets were loaded in-band.
+class CountingAssetLoader : public rive::FileAssetLoader {
+public:
+    std::vector<rive::ImageAsset *> images;
+    std::vector<size_t> font_sizes;
+
+    bool loadContents(rive::FileAsset &asset, rive::Span<const uint8_t> inBandBytes, rive::Factory *factory) override {
+        if (inBandBytes.size() == 0) return false;
+
+        if (asset.is<rive::ImageAsset>()) {
+            images.push_back(asset.as<rive::ImageAsset>());
+        } else if (asset.is<rive::FontAsset>()) {
+            // The font decoder keeps its own copy of the bytes.
+            font_sizes.push_back(inBandBytes.size());
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+rive::rcp<rive::File> import_file(rive::Span<const uint8_t> p_bytes, rive::Factory *p_factory, rive::ImportResult *r_result,
+        const std::shared_ptr<RiveMemoryStats> &p_stats, std::vector<RiveMemoryHandle> &r_handles) {
+    rive::rcp<CountingAssetLoader> loader = rive::make_rcp<CountingAssetLoader>();
+    rive::rcp<rive::File> file = rive::File::import(p_bytes, p_factory, r_result, loader);
+    if (!file) return file;
+
+    // Assets are owned by the file, so the pointers are still valid here.
+    for (rive::ImageAsset *image : loader->images) {
+        rive::RenderImage *render_image = image->renderImage();
+        if (!render_image) continue;
+
+        RiveMemoryHandle handle;
+        handle.track(p_stats, RiveMemoryStats::DECODED_IMAGES, (int64_t)render_image->width() * render_image->height() * 4);
+        r_handles.push_back(std::move(handle));
+    }
+
+    for (size_t font_size : loader->font_sizes) {
+        RiveMemoryHandle handle;
+        handle.track(p_stats, RiveMemoryStats::FONTS, (int64_t)font_size);
+        r_handles.push_back(std::move(handle));
+    }
+
+    return file;
+}
+
+int64_t estimate_artboard(const rive::ArtboardInstance *p_artboard) {
+    if (!p_artboard) return 0;
+    return (int64_t)sizeof(rive::ArtboardInstance) + (int64_t)p_artboard->objects().size() * ESTIMATED_BYTES_PER_OBJECT;
+}
+
+int64_t estimate_state_machine(const rive::StateMachineInstance *p_state_machine) {
+    if (!p_state_machine) return 0;
+    return (int64_t)sizeof(rive::StateMachineInstance) + (int64_t)p_state_machine->inputCount() * ESTIMATED_BYTES_PER_OBJECT;
+}
+
+int64_t estimate_view_model(rive::ViewModelInstance *p_view_model) {
+    if (!p_view_model) return 0;
+    return (int64_t)sizeof(rive::ViewModelInstance) + (int64_t)p_view_model->propertyValues().size() * ESTIMATED_BYTES_PER_OBJECT;
+}
+
+} // namespace rive_memory
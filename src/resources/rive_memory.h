@@ -0,0 +1,80 @@
+#ifndef RIVE_MEMORY_H
+#define RIVE_MEMORY_H
+
+#include <godot_cpp/variant/dictionary.hpp>
+#include "rive/file.hpp"
+#include "rive/artboard.hpp"
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/viewmodel/viewmodel_instance.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace godot;
+
+// Byte and object counters for one RiveFile, or for everything when used as the global summary.
+// Sizes of runtime objects are estimates, rive does not report its own allocations.
+class RiveMemoryStats {
+public:
+    enum Category {
+        FILE_DATA,
+        DECODED_IMAGES,
+        FONTS,
+        ARTBOARDS,
+        STATE_MACHINES,
+        VIEW_MODELS,
+        TEXTURES,
+        CATEGORY_MAX
+    };
+
+private:
+    std::atomic<int64_t> bytes[CATEGORY_MAX] = {};
+    std::atomic<int64_t> counts[CATEGORY_MAX] = {};
+
+public:
+    static RiveMemoryStats &get_global();
+    static const char *get_category_name(Category p_category);
+
+    void add(Category p_category, int64_t p_bytes, int64_t p_count);
+    int64_t get_bytes(Category p_category) const { return bytes[p_category].load(std::memory_order_relaxed); }
+    int64_t get_count(Category p_category) const { return counts[p_category].load(std::memory_order_relaxed); }
+    int64_t get_total_bytes() const;
+
+    Dictionary to_dictionary() const;
+};
+
+// Charges an allocation to a file's stats and to the global stats until released.
+// The stats are shared so instances may outlive the RiveFile they were created from.
+class RiveMemoryHandle {
+    std::shared_ptr<RiveMemoryStats> stats;
+    RiveMemoryStats::Category category = RiveMemoryStats::FILE_DATA;
+    int64_t bytes = 0;
+    bool active = false;
+
+public:
+    RiveMemoryHandle() {}
+    RiveMemoryHandle(RiveMemoryHandle &&p_other) noexcept;
+    RiveMemoryHandle &operator=(RiveMemoryHandle &&p_other) noexcept;
+    RiveMemoryHandle(const RiveMemoryHandle &) = delete;
+    RiveMemoryHandle &operator=(const RiveMemoryHandle &) = delete;
+    ~RiveMemoryHandle() { release(); }
+
+    void track(const std::shared_ptr<RiveMemoryStats> &p_stats, RiveMemoryStats::Category p_category, int64_t p_bytes);
+    void release();
+};
+
+namespace rive_memory {
+
+// Imports through an asset loader that charges decoded images and fonts to p_stats.
+// The handles must be kept alive as long as the returned file.
+rive::rcp<rive::File> import_file(rive::Span<const uint8_t> p_bytes, rive::Factory *p_factory, rive::ImportResult *r_result,
+        const std::shared_ptr<RiveMemoryStats> &p_stats, std::vector<RiveMemoryHandle> &r_handles);
+
+int64_t estimate_artboard(const rive::ArtboardInstance *p_artboard);
+int64_t estimate_state_machine(const rive::StateMachineInstance *p_state_machine);
+int64_t estimate_view_model(rive::ViewModelInstance *p_view_model);
+
+} // namespace rive_memory
+
+#endif // RIVE_MEMORY_H
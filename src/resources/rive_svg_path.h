@@ -0,0 +1,254 @@
+#ifndef RIVE_SVG_PATH_H
+#define RIVE_SVG_PATH_H
+
+#include <cstdint>
+
+// SVG path data ("d" attribute) parser without Godot dependencies, so it can also be
+// exercised by the standalone benchmark. The sink receives move_to, line_to, cubic_to and close.
+namespace rive_svg_path {
+
+inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Converts while scanning. SVG always uses '.' as the decimal point, strtof would follow
+// LC_NUMERIC and misread numbers under comma-decimal locales.
+inline float read_float(const char *d, int len, int &i) {
+    // Skip whitespace/commas
+    while (i < len && (d[i] == ' ' || d[i] == ',' || d[i] == '\t' || d[i] == '\n')) i++;
+
+    bool negative = false;
+    if (i < len && (d[i] == '-' || d[i] == '+')) {
+        negative = d[i] == '-';
+        i++;
+    }
+
+    // Up to 19 significant digits fit the mantissa, later ones only shift the exponent.
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    while (i < len && is_digit(d[i])) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (d[i] - '0');
+            if (mantissa) digits++;
+        } else {
+            exponent++;
+        }
+        i++;
+    }
+    if (i < len && d[i] == '.') {
+        i++;
+        while (i < len && is_digit(d[i])) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (d[i] - '0');
+                if (mantissa) digits++;
+                exponent--;
+            }
+            i++;
+        }
+    }
+    if (i < len && (d[i] == 'e' || d[i] == 'E')) {
+        int e = i + 1;
+        bool exp_negative = false;
+        if (e < len && (d[e] == '-' || d[e] == '+')) {
+            exp_negative = d[e] == '-';
+            e++;
+        }
+        // Only an exponent with digits, so "1e" doesn't swallow a following command letter.
+        if (e < len && is_digit(d[e])) {
+            int value = 0;
+            while (e < len && is_digit(d[e])) {
+                if (value < 10000) value = value * 10 + (d[e] - '0');
+                e++;
+            }
+            exponent += exp_negative ? -value : value;
+            i = e;
+        }
+    }
+
+    double result = (double)mantissa;
+    if (result != 0.0) {
+        double scale = 1.0;
+        double base = 10.0;
+        for (int n = exponent < 0 ? -exponent : exponent; n > 0 && scale < 1e300; n >>= 1) {
+            if (n & 1) scale *= base;
+            base *= base;
+        }
+        result = exponent < 0 ? result / scale : result * scale;
+    }
+    return (float)(negative ? -result : result);
+}
+
+// Appends the outline of one nanosvg shape (NSVGshape), every subpath as cubics. Shared by
+// RiveSVG::parse and the benchmark, so both build exactly the same paths.
+template <typename Shape, typename T>
+void emit_shape(const Shape *shape, T &sink) {
+    for (auto *svg_path = shape->paths; svg_path != nullptr; svg_path = svg_path->next) {
+        if (svg_path->npts < 1) continue;
+
+        sink.move_to(svg_path->pts[0], svg_path->pts[1]);
+        for (int i = 0; i < svg_path->npts - 1; i += 3) {
+            const float *p = &svg_path->pts[i * 2];
+            sink.cubic_to(p[2], p[3], p[4], p[5], p[6], p[7]);
+        }
+        if (svg_path->closed) {
+            sink.close();
+        }
+    }
+}
+
+template <typename T>
+void parse(const char *d, int len, T &sink) {
+    int i = 0;
+    float cur_x = 0, cur_y = 0;
+    float start_x = 0, start_y = 0;
+    float last_ctrl_x = 0, last_ctrl_y = 0;
+    char last_cmd = 0;
+    
+    while (i < len) {
+        char c = d[i];
+        
+        // Skip whitespace
+        if (c == ' ' || c == ',' || c == '\t' || c == '\n') {
+            i++;
+            continue;
+        }
+        
+        if (!is_digit(c) && c != '-' && c != '+' && c != '.') {
+            last_cmd = c;
+            i++;
+        } else {
+            // Implicit command (same as last)
+            if (last_cmd == 'm') last_cmd = 'l';
+            if (last_cmd == 'M') last_cmd = 'L';
+        }
+        
+        switch (last_cmd) {
+            case 'M': {
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                sink.move_to(x, y);
+                cur_x = x; cur_y = y;
+                start_x = x; start_y = y;
+                last_ctrl_x = x; last_ctrl_y = y;
+                break;
+            }
+            case 'm': {
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                sink.move_to(cur_x + x, cur_y + y);
+                cur_x += x; cur_y += y;
+                start_x = cur_x; start_y = cur_y;
+                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
+                break;
+            }
+            case 'L': {
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                sink.line_to(x, y);
+                cur_x = x; cur_y = y;
+                last_ctrl_x = x; last_ctrl_y = y;
+                break;
+            }
+            case 'l': {
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                sink.line_to(cur_x + x, cur_y + y);
+                cur_x += x; cur_y += y;
+                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
+                break;
+            }
+            case 'H': {
+                float x = read_float(d, len, i);
+                sink.line_to(x, cur_y);
+                cur_x = x;
+                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
+                break;
+            }
+            case 'h': {
+                float x = read_float(d, len, i);
+                sink.line_to(cur_x + x, cur_y);
+                cur_x += x;
+                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
+                break;
+            }
+            case 'V': {
+                float y = read_float(d, len, i);
+                sink.line_to(cur_x, y);
+                cur_y = y;
+                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
+                break;
+            }
+            case 'v': {
+                float y = read_float(d, len, i);
+                sink.line_to(cur_x, cur_y + y);
+                cur_y += y;
+                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
+                break;
+            }
+            case 'C': {
+                float x1 = read_float(d, len, i);
+                float y1 = read_float(d, len, i);
+                float x2 = read_float(d, len, i);
+                float y2 = read_float(d, len, i);
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                sink.cubic_to(x1, y1, x2, y2, x, y);
+                last_ctrl_x = x2; last_ctrl_y = y2;
+                cur_x = x; cur_y = y;
+                break;
+            }
+            case 'c': {
+                float x1 = read_float(d, len, i);
+                float y1 = read_float(d, len, i);
+                float x2 = read_float(d, len, i);
+                float y2 = read_float(d, len, i);
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                sink.cubic_to(cur_x + x1, cur_y + y1, cur_x + x2, cur_y + y2, cur_x + x, cur_y + y);
+                last_ctrl_x = cur_x + x2; last_ctrl_y = cur_y + y2;
+                cur_x += x; cur_y += y;
+                break;
+            }
+            case 'S': {
+                float x2 = read_float(d, len, i);
+                float y2 = read_float(d, len, i);
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                float x1 = 2 * cur_x - last_ctrl_x;
+                float y1 = 2 * cur_y - last_ctrl_y;
+                sink.cubic_to(x1, y1, x2, y2, x, y);
+                last_ctrl_x = x2; last_ctrl_y = y2;
+                cur_x = x; cur_y = y;
+                break;
+            }
+            case 's': {
+                float x2 = read_float(d, len, i);
+                float y2 = read_float(d, len, i);
+                float x = read_float(d, len, i);
+                float y = read_float(d, len, i);
+                float x1 = 2 * cur_x - last_ctrl_x;
+                float y1 = 2 * cur_y - last_ctrl_y;
+                sink.cubic_to(x1, y1, cur_x + x2, cur_y + y2, cur_x + x, cur_y + y);
+                last_ctrl_x = cur_x + x2; last_ctrl_y = cur_y + y2;
+                cur_x += x; cur_y += y;
+                break;
+            }
+            case 'Z':
+            case 'z': {
+                sink.close();
+                cur_x = start_x; cur_y = start_y;
+                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
+                break;
+            }
+            default:
+                // Unknown command, skip
+                i++;
+                break;
+        }
+    }
+}
+
+} // namespace rive_svg_path
+
+#endif // RIVE_SVG_PATH_H
@@ -1,5 +1,6 @@
 #include "rive_types.h"
 #include "rive/math/raw_path.hpp"
+#include "rive_svg_path.h"
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <cmath>
@@ -54,35 +55,6 @@ void RivePath::set_fill_rule(int rule) {
     is_dirty = true;
 }
 
-static bool local_is_digit(char32_t c) {
-    return c >= '0' && c <= '9';
-}
-
-static bool is_number_start(char32_t c) {
-    return local_is_digit(c) || c == '+' || c == '-' || c == '.';
-}
-
-static float read_float(const String& d, int& i) {
-    // Skip whitespace/commas
-    while (i < d.length() && (d[i] == ' ' || d[i] == ',' || d[i] == '\t' || d[i] == '\n')) i++;
-    
-    int start = i;
-    if (i < d.length() && (d[i] == '-' || d[i] == '+')) i++;
-    while (i < d.length() && local_is_digit(d[i])) i++;
-    if (i < d.length() && d[i] == '.') {
-        i++;
-        while (i < d.length() && local_is_digit(d[i])) i++;
-    }
-    if (i < d.length() && (d[i] == 'e' || d[i] == 'E')) {
-        i++;
-        if (i < d.length() && (d[i] == '-' || d[i] == '+')) i++;
-        while (i < d.length() && local_is_digit(d[i])) i++;
-    }
-    
-    if (start == i) return 0.0f;
-    return d.substr(start, i - start).to_float();
-}
-
 static void svg_arc_to(RivePath* path, float rx, float ry, float angle, bool large_arc_flag, bool sweep_flag, float x, float y, float cur_x, float cur_y) {
     if (rx == 0 || ry == 0) {
         path->line_to(x, y);
@@ -132,155 +104,8 @@ static void svg_arc_to(RivePath* path, float rx, float ry, float angle, bool lar
 }
 
 void RivePath::parse_svg(String path_data) {
-    int i = 0;
-    int len = path_data.length();
-    float cur_x = 0, cur_y = 0;
-    float start_x = 0, start_y = 0;
-    float last_ctrl_x = 0, last_ctrl_y = 0;
-    char32_t last_cmd = 0;
-    
-    while (i < len) {
-        char32_t c = path_data[i];
-        
-        // Skip whitespace
-        if (c == ' ' || c == ',' || c == '\t' || c == '\n') {
-            i++;
-            continue;
-        }
-        
-        if (!local_is_digit(c) && c != '-' && c != '+' && c != '.') {
-            last_cmd = c;
-            i++;
-        } else {
-            // Implicit command (same as last)
-            if (last_cmd == 'm') last_cmd = 'l';
-            if (last_cmd == 'M') last_cmd = 'L';
-        }
-        
-        switch (last_cmd) {
-            case 'M': {
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                move_to(x, y);
-                cur_x = x; cur_y = y;
-                start_x = x; start_y = y;
-                last_ctrl_x = x; last_ctrl_y = y;
-                break;
-            }
-            case 'm': {
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                move_to(cur_x + x, cur_y + y);
-                cur_x += x; cur_y += y;
-                start_x = cur_x; start_y = cur_y;
-                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
-                break;
-            }
-            case 'L': {
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                line_to(x, y);
-                cur_x = x; cur_y = y;
-                last_ctrl_x = x; last_ctrl_y = y;
-                break;
-            }
-            case 'l': {
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                line_to(cur_x + x, cur_y + y);
-                cur_x += x; cur_y += y;
-                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
-                break;
-            }
-            case 'H': {
-                float x = read_float(path_data, i);
-                line_to(x, cur_y);
-                cur_x = x;
-                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
-                break;
-            }
-            case 'h': {
-                float x = read_float(path_data, i);
-                line_to(cur_x + x, cur_y);
-                cur_x += x;
-                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
-                break;
-            }
-            case 'V': {
-                float y = read_float(path_data, i);
-                line_to(cur_x, y);
-                cur_y = y;
-                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
-                break;
-            }
-            case 'v': {
-                float y = read_float(path_data, i);
-                line_to(cur_x, cur_y + y);
-                cur_y += y;
-                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
-                break;
-            }
-            case 'C': {
-                float x1 = read_float(path_data, i);
-                float y1 = read_float(path_data, i);
-                float x2 = read_float(path_data, i);
-                float y2 = read_float(path_data, i);
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                cubic_to(x1, y1, x2, y2, x, y);
-                last_ctrl_x = x2; last_ctrl_y = y2;
-                cur_x = x; cur_y = y;
-                break;
-            }
-            case 'c': {
-                float x1 = read_float(path_data, i);
-                float y1 = read_float(path_data, i);
-                float x2 = read_float(path_data, i);
-                float y2 = read_float(path_data, i);
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                cubic_to(cur_x + x1, cur_y + y1, cur_x + x2, cur_y + y2, cur_x + x, cur_y + y);
-                last_ctrl_x = cur_x + x2; last_ctrl_y = cur_y + y2;
-                cur_x += x; cur_y += y;
-                break;
-            }
-            case 'S': {
-                float x2 = read_float(path_data, i);
-                float y2 = read_float(path_data, i);
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                float x1 = 2 * cur_x - last_ctrl_x;
-                float y1 = 2 * cur_y - last_ctrl_y;
-                cubic_to(x1, y1, x2, y2, x, y);
-                last_ctrl_x = x2; last_ctrl_y = y2;
-                cur_x = x; cur_y = y;
-                break;
-            }
-            case 's': {
-                float x2 = read_float(path_data, i);
-                float y2 = read_float(path_data, i);
-                float x = read_float(path_data, i);
-                float y = read_float(path_data, i);
-                float x1 = 2 * cur_x - last_ctrl_x;
-                float y1 = 2 * cur_y - last_ctrl_y;
-                cubic_to(x1, y1, cur_x + x2, cur_y + y2, cur_x + x, cur_y + y);
-                last_ctrl_x = cur_x + x2; last_ctrl_y = cur_y + y2;
-                cur_x += x; cur_y += y;
-                break;
-            }
-            case 'Z':
-            case 'z': {
-                close();
-                cur_x = start_x; cur_y = start_y;
-                last_ctrl_x = cur_x; last_ctrl_y = cur_y;
-                break;
-            }
-            default:
-                // Unknown command, skip
-                i++;
-                break;
-        }
-    }
+    CharString utf8 = path_data.utf8();
+    rive_svg_path::parse(utf8.get_data(), utf8.length(), *this);
 }
 
 rive::RenderPath* RivePath::get_render_path(rive::Factory* factory) {
@@ -0,0 +1,76 @@
+#include "rive_monitors.h"
+#include "resources/rive_memory.h"
+#include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+
+using namespace godot;
+
+namespace rive_monitors {
+
+static int64_t get_total_memory() {
+    return RiveMemoryStats::get_global().get_total_bytes();
+}
+
+static int64_t get_file_memory() {
+    const RiveMemoryStats &stats = RiveMemoryStats::get_global();
+    return stats.get_bytes(RiveMemoryStats::FILE_DATA) + stats.get_bytes(RiveMemoryStats::DECODED_IMAGES) + stats.get_bytes(RiveMemoryStats::FONTS);
+}
+
+static int64_t get_texture_memory() {
+    return RiveMemoryStats::get_global().get_bytes(RiveMemoryStats::TEXTURES);
+}
+
+static int64_t get_artboard_count() {
+    return RiveMemoryStats::get_global().get_count(RiveMemoryStats::ARTBOARDS);
+}
+
+static int64_t get_state_machine_count() {
+    return RiveMemoryStats::get_global().get_count(RiveMemoryStats::STATE_MACHINES);
+}
+
+static int64_t get_view_model_count() {
+    return RiveMemoryStats::get_global().get_count(RiveMemoryStats::VIEW_MODELS);
+}
+
+static int64_t get_texture_count() {
+    return RiveMemoryStats::get_global().get_count(RiveMemoryStats::TEXTURES);
+}
+
+struct Monitor {
+    const char *id;
+    int64_t (*getter)();
+};
+
+static const Monitor monitors[] = {
+    { "Rive/Total Memory", &get_total_memory },
+    { "Rive/File Memory", &get_file_memory },
+    { "Rive/Texture Memory", &get_texture_memory },
+    { "Rive/Render Targets", &get_texture_count },
+    { "Rive/Artboards", &get_artboard_count },
+    { "Rive/State Machines", &get_state_machine_count },
+    { "Rive/View Models", &get_view_model_count },
+};
+
+void register_monitors() {
+    Performance *performance = Performance::get_singleton();
+    if (!performance) return;
+
+    for (const Monitor &monitor : monitors) {
+        if (!performance->has_custom_monitor(monitor.id)) {
+            performance->add_custom_monitor(monitor.id, callable_mp_static(monitor.getter));
+        }
+    }
+}
+
+void unregister_monitors() {
+    Performance *performance = Performance::get_singleton();
+    if (!performance) return;
+
+    for (const Monitor &monitor : monitors) {
+        if (performance->has_custom_monitor(monitor.id)) {
+            performance->remove_custom_monitor(monitor.id);
+        }
+    }
+}
+
+} // namespace rive_monitors
@@ -0,0 +1,11 @@
+#ifndef RIVE_MONITORS_H
+#define RIVE_MONITORS_H
+
+// Custom Performance monitors under "Rive/", visible in the debugger and readable from scripts
+// through Performance.get_custom_monitor().
+namespace rive_monitors {
+    void register_monitors();
+    void unregister_monitors();
+}
+
+#endif // RIVE_MONITORS_H
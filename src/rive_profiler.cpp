@@ -0,0 +1,111 @@
+#include "rive_profiler.h"
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> RiveProfiler::capturing{false};
+
+namespace {
+
+struct ZoneEvent {
+    const char *name;
+    uint64_t start_usec;
+    uint64_t end_usec;
+};
+
+struct ThreadBuffer {
+    uint32_t thread_index = 0;
+    bool is_main_thread = false;
+    std::mutex mutex;
+    std::vector<ZoneEvent> events;
+};
+
+std::mutex buffers_mutex;
+// Buffers are owned for the lifetime of the library, pool threads outlive any single capture.
+std::vector<ThreadBuffer *> buffers;
+uint64_t capture_start_usec = 0;
+
+thread_local ThreadBuffer *tls_buffer = nullptr;
+
+ThreadBuffer *get_thread_buffer() {
+    if (!tls_buffer) {
+        ThreadBuffer *buffer = new ThreadBuffer();
+        OS *os = OS::get_singleton();
+        buffer->is_main_thread = os && os->get_thread_caller_id() == os->get_main_thread_id();
+
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        buffer->thread_index = (uint32_t)buffers.size() + 1;
+        buffers.push_back(buffer);
+        tls_buffer = buffer;
+    }
+    return tls_buffer;
+}
+
+} // namespace
+
+void RiveProfiler::_bind_methods() {
+    ClassDB::bind_static_method("RiveProfiler", D_METHOD("start_capture"), &RiveProfiler::start_capture);
+    ClassDB::bind_static_method("RiveProfiler", D_METHOD("stop_capture", "path"), &RiveProfiler::stop_capture);
+    ClassDB::bind_static_method("RiveProfiler", D_METHOD("is_capturing"), &RiveProfiler::is_capturing);
+}
+
+uint64_t RiveProfiler::get_time_usec() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void RiveProfiler::record_zone(const char *p_name, uint64_t p_start_usec, uint64_t p_end_usec) {
+    ThreadBuffer *buffer = get_thread_buffer();
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->events.push_back({ p_name, p_start_usec, p_end_usec });
+}
+
+void RiveProfiler::start_capture() {
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        for (ThreadBuffer *buffer : buffers) {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            buffer->events.clear();
+        }
+        capture_start_usec = get_time_usec();
+    }
+    capturing.store(true, std::memory_order_relaxed);
+}
+
+Error RiveProfiler::stop_capture(const String &p_path) {
+    capturing.store(false, std::memory_order_relaxed);
+
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+    if (file.is_null()) {
+        UtilityFunctions::printerr("RiveProfiler: Failed to open trace file: " + p_path);
+        return FileAccess::get_open_error();
+    }
+
+    file->store_string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    for (ThreadBuffer *buffer : buffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        if (buffer->events.empty()) continue;
+
+        String thread_name = buffer->is_main_thread ? String("Main Thread") : "Worker " + itos(buffer->thread_index);
+        file->store_string(String(first ? "" : ",\n") + "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" + itos(buffer->thread_index) + ",\"args\":{\"name\":\"" + thread_name + "\"}}");
+        first = false;
+
+        for (const ZoneEvent &event : buffer->events) {
+            uint64_t start = event.start_usec >= capture_start_usec ? event.start_usec - capture_start_usec : 0;
+            uint64_t duration = event.end_usec - event.start_usec;
+            file->store_string(",\n{\"ph\":\"X\",\"cat\":\"rive\",\"name\":\"" + String(event.name) + "\",\"pid\":1,\"tid\":" + itos(buffer->thread_index) + ",\"ts\":" + itos(start) + ",\"dur\":" + itos(duration) + "}");
+        }
+        buffer->events.clear();
+    }
+
+    file->store_string("\n]}\n");
+    file->close();
+    return OK;
+}
@@ -0,0 +1,58 @@
+#ifndef RIVE_PROFILER_H
+#define RIVE_PROFILER_H
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <atomic>
+#include <cstdint>
+
+using namespace godot;
+
+// Scoped instrumentation zones exported as Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+// When no capture is running a zone costs a single relaxed atomic load.
+class RiveProfiler : public Object {
+    GDCLASS(RiveProfiler, Object);
+
+    static std::atomic<bool> capturing;
+
+protected:
+    static void _bind_methods();
+
+public:
+    static void start_capture();
+    static Error stop_capture(const String &p_path);
+    static bool is_capturing() { return capturing.load(std::memory_order_relaxed); }
+
+    static uint64_t get_time_usec();
+    static void record_zone(const char *p_name, uint64_t p_start_usec, uint64_t p_end_usec);
+};
+
+class RiveProfileZone {
+    const char *name = nullptr;
+    uint64_t start_usec = 0;
+
+public:
+    explicit RiveProfileZone(const char *p_name) {
+        if (RiveProfiler::is_capturing()) {
+            name = p_name;
+            start_usec = RiveProfiler::get_time_usec();
+        }
+    }
+
+    ~RiveProfileZone() {
+        if (name) {
+            RiveProfiler::record_zone(name, start_usec, RiveProfiler::get_time_usec());
+        }
+    }
+
+    RiveProfileZone(const RiveProfileZone &) = delete;
+    RiveProfileZone &operator=(const RiveProfileZone &) = delete;
+};
+
+#define RIVE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define RIVE_PROFILE_CONCAT(a, b) RIVE_PROFILE_CONCAT_IMPL(a, b)
+
+// Zone names must be string literals, they are stored by pointer until the capture is written.
+#define RIVE_PROFILE_ZONE(m_name) RiveProfileZone RIVE_PROFILE_CONCAT(_rive_profile_zone_, __LINE__)(m_name)
+
+#endif // RIVE_PROFILER_H
@@ -1,4 +1,5 @@
 #include "rive_svg.h"
+#include "resources/rive_svg_path.h"
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <vector>
@@ -134,20 +135,7 @@ void RiveSVG::parse(String xml_content) {
         path.instantiate();
         path->set_fill_rule(shape->fillRule);
         
-        for (NSVGpath* svg_path = shape->paths; svg_path != NULL; svg_path = svg_path->next) {
-            if (svg_path->npts < 1) continue;
-            
-            path->move_to(svg_path->pts[0], svg_path->pts[1]);
-            
-            for (int i = 0; i < svg_path->npts - 1; i += 3) {
-                float* p = &svg_path->pts[i * 2];
-                path->cubic_to(p[2], p[3], p[4], p[5], p[6], p[7]);
-            }
-            
-            if (svg_path->closed) {
-                path->close();
-            }
-        }
+        rive_svg_path::emit_shape(shape, *path.ptr());
         
         // Fill
         bool has_fill = false;
@@ -0,0 +1,31 @@
+#ifndef RIVE_ADVANCE_FENCE_H
+#define RIVE_ADVANCE_FENCE_H
+
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <cstdint>
+
+using namespace godot;
+
+// The WorkerThreadPool task advancing a player, see RivePlayer::advance_async(). Shared with the
+// player's view model wrappers, so script writes through them wait for the task like the player's
+// own methods do. begin() and waiting on a pending task are main thread only. wait() on an idle
+// fence returns at once from any thread, RivePlayer::advance() relies on that in the scheduler's
+// and the canvas' worker batches, which never advance a player with a pending task.
+class RiveAdvanceFence {
+    int64_t task = -1;
+
+public:
+    void begin(int64_t p_task) { task = p_task; }
+    void wait() {
+        if (task == -1) return;
+        ERR_FAIL_COND_MSG(OS::get_singleton()->get_thread_caller_id() != OS::get_singleton()->get_main_thread_id(),
+                "RiveAdvanceFence: a pending advance can only be waited for on the main thread.");
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+        task = -1;
+    }
+    bool is_pending() const { return task != -1; }
+};
+
+#endif // RIVE_ADVANCE_FENCE_H
@@ -0,0 +1,90 @@
+#include "rive_advance_scheduler.h"
+#include "rive_player.h"
+#include "../rive_profiler.h"
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/memory.hpp>
+
+static RiveAdvanceScheduler *_singleton = nullptr;
+
+RiveAdvanceScheduler *RiveAdvanceScheduler::get_singleton() {
+    if (!_singleton) {
+        _singleton = memnew(RiveAdvanceScheduler);
+    }
+    return _singleton;
+}
+
+void RiveAdvanceScheduler::free_singleton() {
+    if (_singleton) {
+        memdelete(_singleton);
+        _singleton = nullptr;
+    }
+}
+
+void RiveAdvanceScheduler::add_player(RivePlayer *p_player, Node *p_owner) {
+    ERR_FAIL_NULL(p_player);
+    if (has_player(p_player)) return;
+    Entry entry;
+    entry.player = p_player;
+    entry.owner = p_owner;
+    entries.push_back(entry);
+}
+
+void RiveAdvanceScheduler::remove_player(RivePlayer *p_player) {
+    for (uint32_t i = 0; i < entries.size(); i++) {
+        if (entries[i].player == p_player) {
+            // Order doesn't matter, every player is advanced by the same delta.
+            entries.remove_at_unordered(i);
+            return;
+        }
+    }
+}
+
+bool RiveAdvanceScheduler::has_player(RivePlayer *p_player) const {
+    for (const Entry &entry : entries) {
+        if (entry.player == p_player) return true;
+    }
+    return false;
+}
+
+// Runs on a worker thread. Players only touch their own artboard, state machine and recording.
+void RiveAdvanceScheduler::_advance_batch(void *p_userdata, uint32_t p_batch) {
+    RiveAdvanceScheduler *scheduler = static_cast<RiveAdvanceScheduler *>(p_userdata);
+    RIVE_PROFILE_ZONE("RiveAdvanceScheduler::advance_batch");
+
+    uint32_t begin = p_batch * scheduler->batch_size;
+    uint32_t end = MIN(begin + scheduler->batch_size, scheduler->active_players.size());
+    for (uint32_t i = begin; i < end; i++) {
+        scheduler->active_players[i]->advance(scheduler->current_delta);
+    }
+}
+
+void RiveAdvanceScheduler::advance_frame(double p_delta) {
+    uint64_t frame = Engine::get_singleton()->get_process_frames();
+    if (frame == advanced_frame) return;
+    advanced_frame = frame;
+
+    RIVE_PROFILE_ZONE("RiveAdvanceScheduler::advance_frame");
+    active_players.clear();
+    for (const Entry &entry : entries) {
+        if (entry.owner && (!entry.owner->is_processing() || !entry.owner->can_process())) continue;
+        active_players.push_back(entry.player);
+    }
+
+    current_delta = p_delta;
+    uint32_t batch_count = (active_players.size() + batch_size - 1) / batch_size;
+    if (batch_count == 1) {
+        _advance_batch(this, 0);
+    } else if (batch_count > 1) {
+        WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+        int64_t group_id = pool->add_native_group_task(&RiveAdvanceScheduler::_advance_batch, this, batch_count, -1, true, "RiveAdvanceScheduler Advance");
+        pool->wait_for_group_task_completion(group_id);
+    }
+}
+
+double RiveAdvanceScheduler::next_phase() {
+    static uint32_t counter = 0;
+    double phase = (counter++) * 0.6180339887498949;
+    return phase - Math::floor(phase);
+}
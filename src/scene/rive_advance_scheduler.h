@@ -0,0 +1,50 @@
+#ifndef RIVE_ADVANCE_SCHEDULER_H
+#define RIVE_ADVANCE_SCHEDULER_H
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <cstdint>
+
+using namespace godot;
+
+class RivePlayer;
+
+// Advances the players of every registered node once per process frame, in parallel batches on the
+// WorkerThreadPool. The first owner to call advance_frame() in a frame does the work for all of them,
+// later calls in the same frame return at once, so each owner can go straight on to render.
+// Main thread only, except for RivePlayer::advance() running on the workers.
+class RiveAdvanceScheduler {
+    struct Entry {
+        RivePlayer *player = nullptr;
+        Node *owner = nullptr;
+    };
+
+    LocalVector<Entry> entries;
+    LocalVector<RivePlayer *> active_players;
+    uint64_t advanced_frame = UINT64_MAX;
+    float current_delta = 0.0f;
+    uint32_t batch_size = 4;
+
+    static void _advance_batch(void *p_userdata, uint32_t p_batch);
+
+public:
+    static RiveAdvanceScheduler *get_singleton();
+    // Called when the extension is unloaded, the registered players are gone by then.
+    static void free_singleton();
+
+    // p_owner must be processing for its player to be advanced, paused nodes are skipped.
+    void add_player(RivePlayer *p_player, Node *p_owner);
+    void remove_player(RivePlayer *p_player);
+    bool has_player(RivePlayer *p_player) const;
+
+    void advance_frame(double p_delta);
+
+    // Phases in [0, 1) for frame rate capped nodes. Consecutive calls are spread evenly (golden
+    // ratio sequence), so nodes sharing a cadence don't all render on the same frame.
+    static double next_phase();
+
+    void set_batch_size(uint32_t p_size) { batch_size = MAX(p_size, 1u); }
+    uint32_t get_batch_size() const { return batch_size; }
+};
+
+#endif // RIVE_ADVANCE_SCHEDULER_H
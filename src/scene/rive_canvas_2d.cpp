@@ -1,23 +1,87 @@
 #include "rive_canvas_2d.h"
 #include "rive_node.h"
+#include "rive_advance_scheduler.h"
 #include "../renderer/rive_renderer.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/core/math.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/rendering_device.hpp>
 #include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/classes/input_event_mouse_button.hpp>
+#include <godot_cpp/classes/input_event_mouse_motion.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 void RiveCanvas2D::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_size", "size"), &RiveCanvas2D::set_size);
     ClassDB::bind_method(D_METHOD("get_size"), &RiveCanvas2D::get_size);
     ClassDB::bind_method(D_METHOD("get_texture"), &RiveCanvas2D::get_texture);
-    ClassDB::bind_method(D_METHOD("_advance_node", "index"), &RiveCanvas2D::_advance_node);
+    ClassDB::bind_method(D_METHOD("set_view_mode", "mode"), &RiveCanvas2D::set_view_mode);
+    ClassDB::bind_method(D_METHOD("get_view_mode"), &RiveCanvas2D::get_view_mode);
+    ClassDB::bind_method(D_METHOD("set_adaptive_resolution", "enabled"), &RiveCanvas2D::set_adaptive_resolution);
+    ClassDB::bind_method(D_METHOD("get_adaptive_resolution"), &RiveCanvas2D::get_adaptive_resolution);
+    ClassDB::bind_method(D_METHOD("set_min_resolution_scale", "scale"), &RiveCanvas2D::set_min_resolution_scale);
+    ClassDB::bind_method(D_METHOD("get_min_resolution_scale"), &RiveCanvas2D::get_min_resolution_scale);
+    ClassDB::bind_method(D_METHOD("set_max_resolution_scale", "scale"), &RiveCanvas2D::set_max_resolution_scale);
+    ClassDB::bind_method(D_METHOD("get_max_resolution_scale"), &RiveCanvas2D::get_max_resolution_scale);
+    ClassDB::bind_method(D_METHOD("set_resolution_hysteresis", "hysteresis"), &RiveCanvas2D::set_resolution_hysteresis);
+    ClassDB::bind_method(D_METHOD("get_resolution_hysteresis"), &RiveCanvas2D::get_resolution_hysteresis);
+    ClassDB::bind_method(D_METHOD("get_resolution_scale"), &RiveCanvas2D::get_resolution_scale);
+    ClassDB::bind_method(D_METHOD("set_tile_size", "size"), &RiveCanvas2D::set_tile_size);
+    ClassDB::bind_method(D_METHOD("get_tile_size"), &RiveCanvas2D::get_tile_size);
+    ClassDB::bind_method(D_METHOD("set_max_cached_tiles", "count"), &RiveCanvas2D::set_max_cached_tiles);
+    ClassDB::bind_method(D_METHOD("get_max_cached_tiles"), &RiveCanvas2D::get_max_cached_tiles);
+    ClassDB::bind_method(D_METHOD("get_cached_tile_count"), &RiveCanvas2D::get_cached_tile_count);
+    ClassDB::bind_method(D_METHOD("set_advance_batch_size", "size"), &RiveCanvas2D::set_advance_batch_size);
+    ClassDB::bind_method(D_METHOD("get_advance_batch_size"), &RiveCanvas2D::get_advance_batch_size);
+    ClassDB::bind_method(D_METHOD("set_animation_lod", "enabled"), &RiveCanvas2D::set_animation_lod);
+    ClassDB::bind_method(D_METHOD("get_animation_lod"), &RiveCanvas2D::get_animation_lod);
+    ClassDB::bind_method(D_METHOD("set_lod_small_size", "size"), &RiveCanvas2D::set_lod_small_size);
+    ClassDB::bind_method(D_METHOD("get_lod_small_size"), &RiveCanvas2D::get_lod_small_size);
+    ClassDB::bind_method(D_METHOD("set_lod_tiny_size", "size"), &RiveCanvas2D::set_lod_tiny_size);
+    ClassDB::bind_method(D_METHOD("get_lod_tiny_size"), &RiveCanvas2D::get_lod_tiny_size);
+    ClassDB::bind_method(D_METHOD("set_max_render_fps", "fps"), &RiveCanvas2D::set_max_render_fps);
+    ClassDB::bind_method(D_METHOD("get_max_render_fps"), &RiveCanvas2D::get_max_render_fps);
+    ClassDB::bind_method(D_METHOD("set_spatial_cell_size", "size"), &RiveCanvas2D::set_spatial_cell_size);
+    ClassDB::bind_method(D_METHOD("get_spatial_cell_size"), &RiveCanvas2D::get_spatial_cell_size);
+    ClassDB::bind_method(D_METHOD("set_pointer_input", "enabled"), &RiveCanvas2D::set_pointer_input);
+    ClassDB::bind_method(D_METHOD("get_pointer_input"), &RiveCanvas2D::get_pointer_input);
+    ClassDB::bind_method(D_METHOD("_on_child_entered_tree", "node"), &RiveCanvas2D::_on_child_entered_tree);
+    ClassDB::bind_method(D_METHOD("_on_child_exiting_tree", "node"), &RiveCanvas2D::_on_child_exiting_tree);
+    ClassDB::bind_method(D_METHOD("_on_child_order_changed"), &RiveCanvas2D::_on_child_order_changed);
 
     ADD_PROPERTY(PropertyInfo(Variant::VECTOR2I, "size"), "set_size", "get_size");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "view_mode", PROPERTY_HINT_ENUM, "Fixed,Follow Viewport,Tiled"), "set_view_mode", "get_view_mode");
+    ADD_GROUP("Tiles", "");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "tile_size", PROPERTY_HINT_RANGE, "64,4096,1"), "set_tile_size", "get_tile_size");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_cached_tiles", PROPERTY_HINT_RANGE, "1,4096,1"), "set_max_cached_tiles", "get_max_cached_tiles");
+    ADD_GROUP("Adaptive Resolution", "");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "adaptive_resolution"), "set_adaptive_resolution", "get_adaptive_resolution");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "min_resolution_scale", PROPERTY_HINT_RANGE, "0.0625,1,0.0625"), "set_min_resolution_scale", "get_min_resolution_scale");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_resolution_scale", PROPERTY_HINT_RANGE, "1,16,1"), "set_max_resolution_scale", "get_max_resolution_scale");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "resolution_hysteresis", PROPERTY_HINT_RANGE, "0,0.5,0.01"), "set_resolution_hysteresis", "get_resolution_hysteresis");
+    ADD_GROUP("Animation LOD", "");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "animation_lod"), "set_animation_lod", "get_animation_lod");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_small_size", PROPERTY_HINT_RANGE, "0,1024,1,suffix:px"), "set_lod_small_size", "get_lod_small_size");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_tiny_size", PROPERTY_HINT_RANGE, "0,1024,1,suffix:px"), "set_lod_tiny_size", "get_lod_tiny_size");
+    ADD_GROUP("", "");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_render_fps", PROPERTY_HINT_RANGE, "0,240,1,suffix:FPS"), "set_max_render_fps", "get_max_render_fps");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "advance_batch_size", PROPERTY_HINT_RANGE, "1,1024,1"), "set_advance_batch_size", "get_advance_batch_size");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "spatial_cell_size", PROPERTY_HINT_RANGE, "16,4096,1"), "set_spatial_cell_size", "get_spatial_cell_size");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "pointer_input"), "set_pointer_input", "get_pointer_input");
+
+    BIND_ENUM_CONSTANT(VIEW_MODE_FIXED);
+    BIND_ENUM_CONSTANT(VIEW_MODE_FOLLOW_VIEWPORT);
+    BIND_ENUM_CONSTANT(VIEW_MODE_TILED);
 }
 
 RiveCanvas2D::RiveCanvas2D() {
     texture_target.instantiate();
+
+    connect("child_entered_tree", Callable(this, "_on_child_entered_tree"));
+    connect("child_exiting_tree", Callable(this, "_on_child_exiting_tree"));
+    connect("child_order_changed", Callable(this, "_on_child_order_changed"));
 }
 
 RiveCanvas2D::~RiveCanvas2D() {
@@ -30,6 +94,7 @@ void RiveCanvas2D::_notification(int p_what) {
     switch (p_what) {
         case NOTIFICATION_READY:
             set_process(true);
+            set_process_unhandled_input(pointer_input);
             break;
     }
 }
@@ -45,6 +110,114 @@ Vector2i RiveCanvas2D::get_size() const {
     return size;
 }
 
+void RiveCanvas2D::set_view_mode(ViewMode p_mode) {
+    if (view_mode != p_mode) {
+        view_mode = p_mode;
+        if (view_mode != VIEW_MODE_TILED) {
+            _clear_tiles();
+        }
+        queue_redraw();
+    }
+}
+
+RiveCanvas2D::ViewMode RiveCanvas2D::get_view_mode() const {
+    return view_mode;
+}
+
+void RiveCanvas2D::set_adaptive_resolution(bool p_enabled) {
+    adaptive_resolution = p_enabled;
+    if (!adaptive_resolution) {
+        resolution_scale = 1.0f;
+    }
+    queue_redraw();
+}
+
+bool RiveCanvas2D::get_adaptive_resolution() const {
+    return adaptive_resolution;
+}
+
+void RiveCanvas2D::set_min_resolution_scale(float p_scale) {
+    min_resolution_scale = CLAMP(p_scale, 0.0625f, 1.0f);
+}
+
+float RiveCanvas2D::get_min_resolution_scale() const {
+    return min_resolution_scale;
+}
+
+void RiveCanvas2D::set_max_resolution_scale(float p_scale) {
+    max_resolution_scale = CLAMP(p_scale, 1.0f, 16.0f);
+}
+
+float RiveCanvas2D::get_max_resolution_scale() const {
+    return max_resolution_scale;
+}
+
+void RiveCanvas2D::set_resolution_hysteresis(float p_hysteresis) {
+    resolution_hysteresis = CLAMP(p_hysteresis, 0.0f, 0.5f);
+}
+
+float RiveCanvas2D::get_resolution_hysteresis() const {
+    return resolution_hysteresis;
+}
+
+float RiveCanvas2D::get_resolution_scale() const {
+    return resolution_scale;
+}
+
+// Tiers are powers of two. Growing happens as soon as the content would be magnified,
+// shrinking only once the screen scale is clearly below the next lower tier, so a camera
+// hovering around a tier boundary doesn't reallocate the target every frame.
+float RiveCanvas2D::_pick_resolution_scale(float p_screen_scale, int p_extent) const {
+    float wanted = min_resolution_scale;
+    while (wanted < p_screen_scale && wanted < max_resolution_scale) {
+        wanted *= 2.0f;
+    }
+    wanted = MIN(wanted, max_resolution_scale);
+
+    // Stay within what a single texture can hold.
+    const float max_dimension = 8192.0f;
+    while (wanted > min_resolution_scale && p_extent * wanted > max_dimension) {
+        wanted *= 0.5f;
+    }
+
+    if (wanted > resolution_scale) {
+        return wanted;
+    }
+    if (wanted < resolution_scale && p_screen_scale < resolution_scale * 0.5f * (1.0f - resolution_hysteresis)) {
+        return wanted;
+    }
+    return resolution_scale;
+}
+
+void RiveCanvas2D::_update_view() {
+    if (view_mode != VIEW_MODE_FIXED && is_inside_tree()) {
+        // The canvas transform carries the Camera2D offset, zoom and rotation.
+        Rect2 visible = get_viewport()->get_visible_rect();
+        render_size = Vector2i((int)Math::ceil(visible.size.x), (int)Math::ceil(visible.size.y));
+        view_transform = Transform2D(0.0, -visible.position) * get_global_transform_with_canvas();
+        view_rect = view_transform.affine_inverse().xform(Rect2(Vector2(), render_size));
+
+        if (view_mode == VIEW_MODE_TILED) {
+            // Tiles render in canvas space, only their resolution follows the zoom.
+            if (adaptive_resolution) {
+                Transform2D screen_xform = get_viewport()->get_final_transform() * get_global_transform_with_canvas();
+                Vector2 screen_scale = screen_xform.get_scale().abs();
+                resolution_scale = _pick_resolution_scale(MAX(screen_scale.x, screen_scale.y), tile_size);
+            }
+            view_transform = Transform2D();
+        }
+    } else {
+        if (adaptive_resolution && is_inside_tree()) {
+            Transform2D screen_xform = get_viewport()->get_final_transform() * get_global_transform_with_canvas();
+            Vector2 screen_scale = screen_xform.get_scale().abs();
+            resolution_scale = _pick_resolution_scale(MAX(screen_scale.x, screen_scale.y), MAX(size.x, size.y));
+        }
+        render_size = Vector2i((int)Math::round(size.x * resolution_scale), (int)Math::round(size.y * resolution_scale));
+        view_transform = Transform2D(0.0, Vector2(resolution_scale, resolution_scale), 0.0, Vector2());
+        view_rect = Rect2(Vector2(), size);
+    }
+}
+
 Ref<Texture2D> RiveCanvas2D::get_texture() const {
     if (texture_target.is_valid()) {
         return texture_target->get_texture_rd();
@@ -52,63 +225,684 @@ Ref<Texture2D> RiveCanvas2D::get_texture() const {
     return Ref<Texture2D>();
 }
 
-void RiveCanvas2D::_advance_node(uint32_t p_index) {
-    if (p_index < active_nodes.size()) {
-        active_nodes[p_index]->advance(current_delta);
+void RiveCanvas2D::set_tile_size(int p_size) {
+    p_size = CLAMP(p_size, 64, 4096);
+    if (tile_size != p_size) {
+        tile_size = p_size;
+        _clear_tiles();
+        queue_redraw();
+    }
+}
+
+int RiveCanvas2D::get_tile_size() const {
+    return tile_size;
+}
+
+void RiveCanvas2D::set_max_cached_tiles(int p_count) {
+    max_cached_tiles = MAX(1, p_count);
+}
+
+int RiveCanvas2D::get_max_cached_tiles() const {
+    return max_cached_tiles;
+}
+
+int RiveCanvas2D::get_cached_tile_count() const {
+    return tiles.size();
+}
+
+void RiveCanvas2D::set_advance_batch_size(int p_size) {
+    advance_batch_size = MAX(1, p_size);
+}
+
+int RiveCanvas2D::get_advance_batch_size() const {
+    return advance_batch_size;
+}
+
+void RiveCanvas2D::set_animation_lod(bool p_enabled) {
+    if (animation_lod == p_enabled) return;
+    animation_lod = p_enabled;
+    // Held back time is dropped, every node goes back to advancing each frame.
+    _update_nodes();
+    for (RiveNode *node : active_nodes) {
+        node->take_lod_delta();
+        node->set_lod_skipped(false);
+    }
+    lod_nodes.clear();
+}
+
+bool RiveCanvas2D::get_animation_lod() const {
+    return animation_lod;
+}
+
+void RiveCanvas2D::set_lod_small_size(float p_size) {
+    lod_small_size = MAX(0.0f, p_size);
+}
+
+float RiveCanvas2D::get_lod_small_size() const {
+    return lod_small_size;
+}
+
+void RiveCanvas2D::set_lod_tiny_size(float p_size) {
+    lod_tiny_size = MAX(0.0f, p_size);
+}
+
+float RiveCanvas2D::get_lod_tiny_size() const {
+    return lod_tiny_size;
+}
+
+void RiveCanvas2D::set_max_render_fps(int p_fps) {
+    max_render_fps = MAX(0, p_fps);
+    pending_delta = 0.0;
+    cadence_time = max_render_fps > 0 ? RiveAdvanceScheduler::next_phase() / max_render_fps : 0.0;
+}
+
+int RiveCanvas2D::get_max_render_fps() const {
+    return max_render_fps;
+}
+
+void RiveCanvas2D::set_spatial_cell_size(float p_size) {
+    spatial_index.set_cell_size(p_size);
+}
+
+float RiveCanvas2D::get_spatial_cell_size() const {
+    return spatial_index.get_cell_size();
+}
+
+void RiveCanvas2D::set_pointer_input(bool p_enabled) {
+    pointer_input = p_enabled;
+    if (is_inside_tree()) {
+        set_process_unhandled_input(pointer_input);
+    }
+}
+
+bool RiveCanvas2D::get_pointer_input() const {
+    return pointer_input;
+}
+
+void RiveCanvas2D::_on_child_entered_tree(Node *p_node) {
+    RiveNode *node = Object::cast_to<RiveNode>(p_node);
+    if (node) {
+        node->set_container_slot(active_nodes.size());
+        active_nodes.push_back(node);
+        node->set_container(this);
+        dirty_nodes.push_back(node);
+    }
+}
+
+void RiveCanvas2D::_on_child_exiting_tree(Node *p_node) {
+    RiveNode *node = Object::cast_to<RiveNode>(p_node);
+    if (node) {
+        // Cleared now, compacted once in _update_nodes(), so despawning many nodes stays linear.
+        uint32_t slot = node->get_container_slot();
+        if (slot < active_nodes.size() && active_nodes[slot] == node) {
+            active_nodes[slot] = nullptr;
+            nodes_removed = true;
+        }
+        if (node->is_bounds_dirty()) {
+            dirty_nodes.erase(node);
+        }
+        Rect2 old_bounds;
+        if (spatial_index.get_bounds(node, old_bounds)) {
+            _invalidate_tiles(old_bounds);
+        }
+        spatial_index.remove(node);
+        node->set_container(nullptr);
+
+        if (pressed_node == node) pressed_node = nullptr;
+        hovered_nodes.erase(node);
+    }
+}
+
+void RiveCanvas2D::_rive_node_bounds_changed(RiveNode *p_node) {
+    dirty_nodes.push_back(p_node);
+    // Moved, shown, hidden or reloaded nodes skip the max_render_fps cadence.
+    render_requested = true;
+}
+
+void RiveCanvas2D::_renumber_nodes(uint32_t p_from) {
+    for (uint32_t i = p_from; i < active_nodes.size(); i++) {
+        active_nodes[i]->set_container_slot(i);
+    }
+}
+
+void RiveCanvas2D::_flush_spatial_index() {
+    for (RiveNode *node : dirty_nodes) {
+        Rect2 bounds = node->get_rive_bounds();
+        if (bounds.has_area()) {
+            bounds = node->get_transform().xform(bounds);
+        }
+
+        Rect2 old_bounds;
+        if (spatial_index.get_bounds(node, old_bounds)) {
+            _invalidate_tiles(old_bounds);
+        }
+        _invalidate_tiles(bounds);
+
+        spatial_index.update(node, bounds);
+        node->clear_bounds_dirty();
+    }
+    dirty_nodes.clear();
+}
+
+// Query results in child order, so they draw and receive input like the scene tree suggests.
+void RiveCanvas2D::_query_sorted(const Rect2 &p_rect, LocalVector<RiveNode*> &r_nodes) {
+    struct SlotComparator {
+        bool operator()(const RiveNode *a, const RiveNode *b) const {
+            return a->get_container_slot() < b->get_container_slot();
+        }
+    };
+
+    _update_nodes();
+    _flush_spatial_index();
+
+    r_nodes.clear();
+    if (p_rect.has_area()) {
+        spatial_index.query_rect(p_rect, r_nodes);
+    } else {
+        spatial_index.query_point(p_rect.position, r_nodes);
+    }
+    r_nodes.sort_custom<SlotComparator>();
+}
+
+// Also emitted by every add_child() and remove_child(), the order is only checked in _sort_nodes().
+void RiveCanvas2D::_on_child_order_changed() {
+    nodes_order_dirty = true;
+}
+
+void RiveCanvas2D::_update_nodes() {
+    if (nodes_removed) {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < active_nodes.size(); i++) {
+            if (active_nodes[i]) {
+                active_nodes[count++] = active_nodes[i];
+            }
+        }
+        active_nodes.resize(count);
+        _renumber_nodes(0);
+        nodes_removed = false;
+    }
+    if (nodes_order_dirty) {
+        _sort_nodes();
+    }
+}
+
+// Nodes are appended as they enter, so appending add_child() and remove_child() leave the order
+// sorted. Only nodes that actually changed places in the stacking order invalidate their tiles.
+void RiveCanvas2D::_sort_nodes() {
+    struct IndexComparator {
+        bool operator()(const RiveNode *a, const RiveNode *b) const {
+            return a->get_index() < b->get_index();
+        }
+    };
+    nodes_order_dirty = false;
+
+    bool sorted = true;
+    for (uint32_t i = 1; i < active_nodes.size() && sorted; i++) {
+        sorted = active_nodes[i - 1]->get_index() < active_nodes[i]->get_index();
+    }
+    if (sorted) return;
+
+    // Slots still hold the old order. A node whose old predecessor is no longer right before it
+    // was moved, inserted or lost a neighbour, its bounds may now overlap differently.
+    active_nodes.sort_custom<IndexComparator>();
+    int64_t previous_slot = -1;
+    for (RiveNode *node : active_nodes) {
+        int64_t slot = node->get_container_slot();
+        if (slot != previous_slot + 1) {
+            Rect2 bounds;
+            if (spatial_index.get_bounds(node, bounds)) {
+                _invalidate_tiles(bounds);
+            }
+        }
+        previous_slot = slot;
+    }
+    _renumber_nodes(0);
+}
+
+// Runs on a worker thread, one call advances up to advance_batch_size consecutive nodes.
+void RiveCanvas2D::_advance_batch(void *p_userdata, uint32_t p_batch) {
+    RiveCanvas2D *canvas = static_cast<RiveCanvas2D *>(p_userdata);
+    RIVE_PROFILE_ZONE("RiveCanvas2D::advance_node");
+
+    if (canvas->animation_lod) {
+        uint32_t begin = p_batch * canvas->advance_batch_size;
+        uint32_t end = MIN(begin + canvas->advance_batch_size, canvas->lod_nodes.size());
+        for (uint32_t i = begin; i < end; i++) {
+            RiveNode *node = canvas->lod_nodes[i];
+            node->advance(node->take_lod_delta());
+        }
+        return;
+    }
+
+    uint32_t begin = p_batch * canvas->advance_batch_size;
+    uint32_t end = MIN(begin + canvas->advance_batch_size, canvas->active_nodes.size());
+    for (uint32_t i = begin; i < end; i++) {
+        canvas->active_nodes[i]->advance(canvas->current_delta);
+    }
+}
+
+// 1 advances every frame, 0 never. Nodes without bounds can't be judged and stay at full rate.
+uint32_t RiveCanvas2D::_get_lod_interval(RiveNode *p_node, float p_screen_scale) const {
+    if (!p_node->is_visible()) return 0;
+
+    Rect2 bounds;
+    if (!spatial_index.get_bounds(p_node, bounds) || !bounds.has_area()) return 1;
+    if (!bounds.intersects(view_rect)) return 0;
+
+    float extent = MAX(bounds.size.x, bounds.size.y) * p_screen_scale;
+    if (extent < lod_tiny_size) return 4;
+    if (extent < lod_small_size) return 2;
+    return 1;
+}
+
+// Collects the nodes due this frame into lod_nodes. The phase comes from the node's slot, so
+// nodes sharing an interval are spread over its frames instead of all advancing on the same one.
+void RiveCanvas2D::_pick_lod_nodes(double p_delta) {
+    RIVE_PROFILE_ZONE("RiveCanvas2D::pick_lod_nodes");
+    _update_view();
+    _flush_spatial_index();
+
+    float screen_scale = 1.0f;
+    if (is_inside_tree()) {
+        Transform2D screen_xform = get_viewport()->get_final_transform() * get_global_transform_with_canvas();
+        Vector2 scale = screen_xform.get_scale().abs();
+        screen_scale = MAX(scale.x, scale.y);
+    }
+
+    lod_frame++;
+    lod_nodes.clear();
+    for (RiveNode *node : active_nodes) {
+        node->add_lod_delta(p_delta);
+        uint32_t interval = _get_lod_interval(node, screen_scale);
+        bool due = interval > 0 && (lod_frame + node->get_container_slot()) % interval == 0;
+        node->set_lod_skipped(!due);
+        if (due) {
+            lod_nodes.push_back(node);
+        }
     }
 }
 
 void RiveCanvas2D::_process(double delta) {
-    active_nodes.clear();
-    for (int i = 0; i < get_child_count(); i++) {
-        RiveNode *node = Object::cast_to<RiveNode>(get_child(i));
-        if (node) {
-            active_nodes.push_back(node);
+    RIVE_PROFILE_ZONE("RiveCanvas2D::_process");
+    _update_nodes();
+    if (max_render_fps > 0) {
+        pending_delta += delta;
+        cadence_time += delta;
+        double interval = 1.0 / max_render_fps;
+        bool due = render_requested || cadence_time >= interval;
+        if (cadence_time >= interval) {
+            cadence_time = Math::fmod(cadence_time, interval);
+        }
+        for (uint32_t i = 0; i < active_nodes.size() && !due; i++) {
+            // Data writes and input sent straight to a node's player. Nodes the LOD pauses
+            // aren't advanced, so their change would stay pending and keep the cap off.
+            RiveNode *node = active_nodes[i];
+            if (animation_lod && _get_lod_interval(node, 1.0f) == 0) continue;
+            due = node->has_external_change();
         }
+        if (view_mode != VIEW_MODE_FIXED && is_inside_tree()) {
+            // The texture only covers the old view, a moved camera can't wait.
+            Transform2D view_xform = get_global_transform_with_canvas();
+            if (view_xform != cadence_view_xform) {
+                cadence_view_xform = view_xform;
+                due = true;
+            }
+        }
+        if (!due) return;
+
+        render_requested = false;
+        delta = pending_delta;
+        pending_delta = 0.0;
     }
 
-    if (active_nodes.size() > 0) {
-        current_delta = delta;
-        int64_t group_id = WorkerThreadPool::get_singleton()->add_group_task(Callable(this, "_advance_node"), active_nodes.size(), -1, true, "RiveCanvas2D Advance");
-        WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+    uint32_t node_count = active_nodes.size();
+    if (animation_lod) {
+        _pick_lod_nodes(delta);
+        node_count = lod_nodes.size();
+    }
+
+    uint32_t batch_count = (node_count + advance_batch_size - 1) / advance_batch_size;
+    current_delta = delta;
+    if (batch_count == 1) {
+        // Not worth a round trip through the pool.
+        _advance_batch(this, 0);
+    } else if (batch_count > 1) {
+        WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+        int64_t group_id = pool->add_native_group_task(&RiveCanvas2D::_advance_batch, this, batch_count, -1, true, "RiveCanvas2D Advance");
+        pool->wait_for_group_task_completion(group_id);
     }
     
     queue_redraw();
 }
 
 void RiveCanvas2D::_draw() {
-    if (size.x <= 0 || size.y <= 0) return;
+    if (view_mode == VIEW_MODE_TILED) {
+        _draw_tiled();
+        return;
+    }
+
+    _update_view();
+    if (render_size.x <= 0 || render_size.y <= 0) return;
     if (!texture_target.is_valid()) return;
 
-    texture_target->resize(size);
+    Rect2 dest_rect(Point2(), size);
+    Transform2D screen_transform = view_transform;
+    if (view_mode == VIEW_MODE_FOLLOW_VIEWPORT) {
+        Rect2i crop;
+        if (!_crop_to_content(crop)) return;
+        render_size = crop.size;
+        view_transform = Transform2D(0.0, -Vector2(crop.position)) * view_transform;
+        dest_rect = Rect2(crop.position, crop.size);
+    }
+
+    texture_target->resize(render_size);
 
     RenderingServer *rs = RenderingServer::get_singleton();
     if (!rs) return;
     RenderingDevice *rd = rs->get_rendering_device();
 
-    rive_integration::render_texture(rd, texture_target->get_texture_rid(), this, size.x, size.y);
+    rive_integration::render_texture(rd, texture_target->get_texture_rid(), this, render_size.x, render_size.y);
+
+    if (view_mode == VIEW_MODE_FOLLOW_VIEWPORT) {
+        // Undo the canvas transform so the texture lands 1:1 on the viewport.
+        draw_set_transform_matrix(screen_transform.affine_inverse());
+    }
 
     if (texture_target->get_texture_rd().is_valid()) {
-        draw_texture(texture_target->get_texture_rd(), Point2(0, 0));
+        draw_texture_rect(texture_target->get_texture_rd(), dest_rect, false);
     } else if (texture_target->get_texture_rid().is_valid()) {
-        rs->canvas_item_add_texture_rect(get_canvas_item(), Rect2(Point2(), size), texture_target->get_texture_rid());
+        rs->canvas_item_add_texture_rect(get_canvas_item(), dest_rect, texture_target->get_texture_rid());
     }
 }
 
+// Follow viewport mode: the part of the view, in target pixels, covered by visible nodes. The size
+// is rounded up to CONTENT_CROP_STEP so moving content doesn't recreate the texture every frame.
+// False if nothing visible is in view, then there is nothing to render or draw.
+bool RiveCanvas2D::_crop_to_content(Rect2i &r_crop) {
+    static const int CONTENT_CROP_STEP = 64;
+    Rect2i view(Point2i(), render_size);
+
+    _query_sorted(view_rect, query_nodes);
+    Rect2 content;
+    bool found = false;
+    for (RiveNode *node : query_nodes) {
+        if (!node->is_visible()) continue;
+        Rect2 bounds;
+        if (!spatial_index.get_bounds(node, bounds) || !bounds.has_area()) {
+            r_crop = view;
+            return true;
+        }
+        content = found ? content.merge(bounds) : bounds;
+        found = true;
+    }
+    if (!found) return false;
+
+    // One pixel of margin for antialiasing.
+    Rect2 pixels = view_transform.xform(content).grow(1.0);
+    Point2i begin((int)Math::floor(pixels.position.x), (int)Math::floor(pixels.position.y));
+    Point2i end((int)Math::ceil(pixels.get_end().x), (int)Math::ceil(pixels.get_end().y));
+    Rect2i crop = Rect2i(begin, end - begin).intersection(view);
+    if (crop.size.x <= 0 || crop.size.y <= 0) return false;
+
+    Vector2i stepped = (crop.size + Vector2i(CONTENT_CROP_STEP - 1, CONTENT_CROP_STEP - 1)) / CONTENT_CROP_STEP * CONTENT_CROP_STEP;
+    crop.size = Vector2i(MIN(stepped.x, render_size.x), MIN(stepped.y, render_size.y));
+    // Grown towards the far edges; shift back where that leaves the view.
+    crop.position = Point2i(MIN(crop.position.x, render_size.x - crop.size.x), MIN(crop.position.y, render_size.y - crop.size.y));
+    r_crop = crop;
+    return true;
+}
+
 void RiveCanvas2D::draw(rive::Renderer *renderer) {
-    Rect2 canvas_rect(0, 0, size.x, size.y);
-    for (int i = 0; i < get_child_count(); i++) {
-        RiveNode *node = Object::cast_to<RiveNode>(get_child(i));
-        if (node && node->is_visible()) {
-            Rect2 node_bounds = node->get_rive_bounds();
-            Transform2D node_xform = node->get_transform();
-            Rect2 transformed_bounds = node_xform.xform(node_bounds);
-            
-            if (canvas_rect.intersects(transformed_bounds)) {
-                renderer->save();
-                node->draw(renderer);
-                renderer->restore();
+    RIVE_PROFILE_ZONE("RiveCanvas2D::draw");
+    _query_sorted(view_rect, query_nodes);
+    _draw_nodes(renderer, query_nodes, view_transform, view_rect);
+}
+
+void RiveCanvas2D::_draw_nodes(rive::Renderer *renderer, const LocalVector<RiveNode*> &p_nodes, const Transform2D &p_transform, const Rect2 &p_cull_rect) {
+    renderer->save();
+    renderer->transform(rive::Mat2D(
+        p_transform.columns[0].x, p_transform.columns[0].y,
+        p_transform.columns[1].x, p_transform.columns[1].y,
+        p_transform.columns[2].x, p_transform.columns[2].y
+    ));
+
+    for (RiveNode *node : p_nodes) {
+        if (node->is_visible()) {
+            renderer->save();
+            node->draw_culled(renderer, p_cull_rect);
+            renderer->restore();
+        }
+    }
+
+    renderer->restore();
+}
+
+void RiveCanvas2D::TileDrawable::draw(rive::Renderer *renderer) {
+    canvas->_draw_nodes(renderer, canvas->tile_nodes, transform, rect);
+}
+
+static uint64_t tile_key(int32_t p_x, int32_t p_y) {
+    return ((uint64_t)(uint32_t)p_x << 32) | (uint32_t)p_y;
+}
+
+// Zoomed far out, even small tiles add up. Past this the view is clipped instead of
+// allocating hundreds of targets in one frame.
+static const int64_t MAX_VISIBLE_TILES = 256;
+
+void RiveCanvas2D::_draw_tiled() {
+    RIVE_PROFILE_ZONE("RiveCanvas2D::draw_tiled");
+    if (!texture_target.is_valid() || !is_inside_tree()) return;
+
+    _update_view();
+    if (!view_rect.has_area()) return;
+
+    if (resolution_scale != tile_scale) {
+        _invalidate_tiles(Rect2());
+        tile_scale = resolution_scale;
+    }
+    int tile_pixels = MAX(1, (int)Math::round(tile_size * resolution_scale));
+
+    Vector2i from((int32_t)Math::floor(view_rect.position.x / tile_size), (int32_t)Math::floor(view_rect.position.y / tile_size));
+    Vector2i to((int32_t)Math::floor(view_rect.get_end().x / tile_size), (int32_t)Math::floor(view_rect.get_end().y / tile_size));
+    Vector2i count = to - from + Vector2i(1, 1);
+    if ((int64_t)count.x * count.y > MAX_VISIBLE_TILES) {
+        WARN_PRINT_ONCE("RiveCanvas2D: Too many visible tiles, increase tile_size.");
+        count.x = MIN(count.x, (int32_t)MAX_VISIBLE_TILES);
+        count.y = MAX(1, (int32_t)(MAX_VISIBLE_TILES / count.x));
+    }
+
+    RenderingServer *rs = RenderingServer::get_singleton();
+    if (!rs) return;
+    RenderingDevice *rd = rs->get_rendering_device();
+
+    tile_frame++;
+    tile_drawable.canvas = this;
+
+    for (int32_t y = from.y; y < from.y + count.y; y++) {
+        for (int32_t x = from.x; x < from.x + count.x; x++) {
+            Rect2 tile_rect(x * tile_size, y * tile_size, tile_size, tile_size);
+            _query_sorted(tile_rect, tile_nodes);
+
+            bool any_visible = false;
+            bool animating = false;
+            // Animating nodes the LOD skipped this frame still show the pose already on the tile.
+            bool deferred = false;
+            for (RiveNode *node : tile_nodes) {
+                if (node->is_visible()) {
+                    any_visible = true;
+                    if (node->is_animating()) {
+                        if (node->is_lod_skipped()) {
+                            deferred = true;
+                        } else {
+                            animating = true;
+                        }
+                    }
+                }
+            }
+            if (!any_visible) continue;
+
+            Tile &tile = tiles[tile_key(x, y)];
+            tile.last_used_frame = tile_frame;
+            if (tile.target.is_null()) {
+                if (!spare_tile_targets.is_empty()) {
+                    tile.target = spare_tile_targets[spare_tile_targets.size() - 1];
+                    spare_tile_targets.resize(spare_tile_targets.size() - 1);
+                } else {
+                    tile.target.instantiate();
+                }
+                tile.valid = false;
+            }
+            if (tile.target->resize(Vector2i(tile_pixels, tile_pixels))) {
+                tile.valid = false;
+            }
+
+            if (!tile.valid || animating || (tile.had_animation && !deferred)) {
+                tile_drawable.transform = Transform2D(0.0, Vector2(resolution_scale, resolution_scale), 0.0, -tile_rect.position * resolution_scale);
+                tile_drawable.rect = tile_rect;
+                rive_integration::render_texture(rd, tile.target->get_texture_rid(), &tile_drawable, tile_pixels, tile_pixels);
+                tile.valid = true;
+                tile.had_animation = animating;
+            }
+
+            if (tile.target->get_texture_rd().is_valid()) {
+                draw_texture_rect(tile.target->get_texture_rd(), tile_rect, false);
+            } else if (tile.target->get_texture_rid().is_valid()) {
+                rs->canvas_item_add_texture_rect(get_canvas_item(), tile_rect, tile.target->get_texture_rid());
+            }
+        }
+    }
+
+    _evict_tiles();
+}
+
+// An empty rect invalidates every tile.
+void RiveCanvas2D::_invalidate_tiles(const Rect2 &p_rect) {
+    if (tiles.is_empty()) return;
+
+    if (!p_rect.has_area()) {
+        for (KeyValue<uint64_t, Tile> &E : tiles) {
+            E.value.valid = false;
+        }
+        return;
+    }
+
+    Vector2i from((int32_t)Math::floor(p_rect.position.x / tile_size), (int32_t)Math::floor(p_rect.position.y / tile_size));
+    Vector2i to((int32_t)Math::floor(p_rect.get_end().x / tile_size), (int32_t)Math::floor(p_rect.get_end().y / tile_size));
+    if ((int64_t)(to.x - from.x + 1) * (to.y - from.y + 1) > (int64_t)tiles.size()) {
+        // Cheaper to walk the cache than the covered range.
+        for (KeyValue<uint64_t, Tile> &E : tiles) {
+            int32_t x = (int32_t)(E.key >> 32);
+            int32_t y = (int32_t)(E.key & 0xFFFFFFFF);
+            if (x >= from.x && x <= to.x && y >= from.y && y <= to.y) {
+                E.value.valid = false;
+            }
+        }
+        return;
+    }
+
+    for (int32_t y = from.y; y <= to.y; y++) {
+        for (int32_t x = from.x; x <= to.x; x++) {
+            HashMap<uint64_t, Tile>::Iterator it = tiles.find(tile_key(x, y));
+            if (it != tiles.end()) {
+                it->value.valid = false;
+            }
+        }
+    }
+}
+
+void RiveCanvas2D::_clear_tiles() {
+    tiles.clear();
+    spare_tile_targets.clear();
+}
+
+// Drops least recently used tiles that were not on screen this frame until the cache fits.
+void RiveCanvas2D::_evict_tiles() {
+    if ((int)tiles.size() <= max_cached_tiles) return;
+
+    struct LRUEntry {
+        uint64_t last_used;
+        uint64_t key;
+        bool operator<(const LRUEntry &p_other) const { return last_used < p_other.last_used; }
+    };
+
+    LocalVector<LRUEntry> candidates;
+    for (const KeyValue<uint64_t, Tile> &E : tiles) {
+        if (E.value.last_used_frame != tile_frame) {
+            candidates.push_back({ E.value.last_used_frame, E.key });
+        }
+    }
+    candidates.sort();
+
+    const uint32_t max_spare_targets = 4;
+    for (const LRUEntry &entry : candidates) {
+        if ((int)tiles.size() <= max_cached_tiles) break;
+
+        HashMap<uint64_t, Tile>::Iterator it = tiles.find(entry.key);
+        if (spare_tile_targets.size() < max_spare_targets) {
+            spare_tile_targets.push_back(it->value.target);
+        }
+        tiles.remove(it);
+    }
+}
+
+void RiveCanvas2D::_unhandled_input(const Ref<InputEvent> &p_event) {
+    Ref<InputEventMouse> mouse_event = p_event;
+    if (mouse_event.is_null()) return;
+
+    Ref<InputEventMouse> local_event = make_input_local(p_event);
+    Vector2 local_pos = local_event->get_position();
+    _query_sorted(Rect2(local_pos, Vector2()), query_nodes);
+    bool hit = false;
+    if (!query_nodes.is_empty() || !hovered_nodes.is_empty()) {
+        // Pointer reactions skip the max_render_fps cadence.
+        render_requested = true;
+    }
+
+    Ref<InputEventMouseMotion> motion = local_event;
+    if (motion.is_valid()) {
+        // Nodes the pointer just left still get the move so their state machines see the exit.
+        for (RiveNode *node : hovered_nodes) {
+            if (!query_nodes.has(node)) {
+                node->pointer_move(local_pos);
+            }
+        }
+        hovered_nodes.clear();
+        for (RiveNode *node : query_nodes) {
+            if (node->is_visible()) {
+                hit |= node->pointer_move(local_pos);
+                hovered_nodes.push_back(node);
             }
         }
     }
+
+    Ref<InputEventMouseButton> button = local_event;
+    if (button.is_valid() && button->get_button_index() == MOUSE_BUTTON_LEFT) {
+        if (button->is_pressed()) {
+            // Topmost node first, the first one that reports a hit takes the press.
+            for (int64_t i = (int64_t)query_nodes.size() - 1; i >= 0; i--) {
+                RiveNode *node = query_nodes[i];
+                if (node->is_visible() && node->pointer_down(local_pos)) {
+                    pressed_node = node;
+                    hit = true;
+                    break;
+                }
+            }
+        } else if (pressed_node) {
+            pressed_node->pointer_up(local_pos);
+            pressed_node = nullptr;
+            hit = true;
+        } else {
+            for (int64_t i = (int64_t)query_nodes.size() - 1; i >= 0; i--) {
+                RiveNode *node = query_nodes[i];
+                if (node->is_visible() && node->pointer_up(local_pos)) {
+                    hit = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (hit) {
+        get_viewport()->set_input_as_handled();
+    }
 }
@@ -4,24 +4,128 @@
 #include <godot_cpp/classes/node2d.hpp>
 #include <godot_cpp/classes/texture2drd.hpp>
 #include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 #include "../renderer/rive_render_registry.h"
 #include "../renderer/rive_texture_target.h"
 #include "rive_node.h"
+#include "rive_spatial_index.h"
+#include <godot_cpp/classes/input_event.hpp>
 #include <rive/renderer.hpp>
 
 using namespace godot;
 
-class RiveCanvas2D : public Node2D, public RiveDrawable {
+class RiveCanvas2D : public Node2D, public RiveDrawable, public RiveNodeContainer {
     GDCLASS(RiveCanvas2D, Node2D);
 
+public:
+    enum ViewMode {
+        // Renders a texture of `size` at the node origin.
+        VIEW_MODE_FIXED,
+        // Renders the visible part of the viewport, following the canvas transform (and so the
+        // active Camera2D). `size` is ignored. The texture only covers the visible nodes' bounds,
+        // and nothing is rendered or drawn while none are in view. Still composited through a
+        // texture, see README "Limitations" for why rendering into the viewport target isn't possible.
+        VIEW_MODE_FOLLOW_VIEWPORT,
+        // Covers the visible part of the canvas with tile_size tiles. Tiles are cached and only
+        // re-rendered when their nodes move, change or animate. `size` is ignored.
+        VIEW_MODE_TILED,
+    };
+
 private:
     Ref<RiveTextureTarget> texture_target;
     Vector2i size = Vector2i(512, 512);
+    ViewMode view_mode = VIEW_MODE_FIXED;
+
+    // Fixed mode only: render at a power of two multiple of `size` matching the on-screen scale.
+    bool adaptive_resolution = false;
+    float min_resolution_scale = 0.25f;
+    float max_resolution_scale = 4.0f;
+    float resolution_hysteresis = 0.15f;
+    float resolution_scale = 1.0f;
+
+    // Resolved at the start of each _draw: render target size, canvas space -> target pixels,
+    // and the canvas space rect that ends up on the target.
+    Vector2i render_size;
+    Transform2D view_transform;
+    Rect2 view_rect;
+
+    struct Tile {
+        Ref<RiveTextureTarget> target;
+        uint64_t last_used_frame = 0;
+        bool valid = false;
+        // Rendered while something animated, needs one more render to pick up the final pose.
+        bool had_animation = false;
+    };
+
+    // One drawable for all tiles, so backends keep reusing the same render target state.
+    struct TileDrawable : public RiveDrawable {
+        RiveCanvas2D *canvas = nullptr;
+        Transform2D transform;
+        Rect2 rect;
+        void draw(rive::Renderer *renderer) override;
+    };
+
+    int tile_size = 512;
+    int max_cached_tiles = 64;
+    HashMap<uint64_t, Tile> tiles;
+    LocalVector<Ref<RiveTextureTarget>> spare_tile_targets;
+    LocalVector<RiveNode*> tile_nodes;
+    TileDrawable tile_drawable;
+    float tile_scale = 1.0f;
+    uint64_t tile_frame = 0;
     
+    // Direct RiveNode children in child order, kept up to date from the tree signals. Exiting
+    // nodes leave a null slot until the next _update_nodes().
     LocalVector<RiveNode*> active_nodes;
+    bool nodes_order_dirty = false;
+    bool nodes_removed = false;
+    int advance_batch_size = 16;
     double current_delta = 0.0;
 
-    void _advance_node(uint32_t p_index);
+    // Animation LOD: nodes smaller than lod_small_size / lod_tiny_size screen pixels advance every
+    // 2nd / 4th frame, hidden and off-screen nodes not at all. Skipped time is accumulated per node.
+    bool animation_lod = false;
+    float lod_small_size = 64.0f;
+    float lod_tiny_size = 16.0f;
+    uint64_t lod_frame = 0;
+    LocalVector<RiveNode*> lod_nodes;
+
+    // 0 advances and renders every frame. Otherwise delta is banked and spent on the cadence.
+    // Pointer input, camera moves, node bounds changes (render_requested) and nodes reporting
+    // has_external_change(), e.g. view model writes, render right away.
+    int max_render_fps = 0;
+    double cadence_time = 0.0;
+    double pending_delta = 0.0;
+    bool render_requested = false;
+    Transform2D cadence_view_xform;
+
+    // Node bounds in canvas space, refreshed lazily from dirty_nodes before culling or hit-testing.
+    RiveSpatialIndex spatial_index;
+    LocalVector<RiveNode*> dirty_nodes;
+    LocalVector<RiveNode*> query_nodes;
+    bool pointer_input = true;
+    RiveNode *pressed_node = nullptr;
+    LocalVector<RiveNode*> hovered_nodes;
+
+    static void _advance_batch(void *p_userdata, uint32_t p_batch);
+    void _pick_lod_nodes(double p_delta);
+    uint32_t _get_lod_interval(RiveNode *p_node, float p_screen_scale) const;
+    void _on_child_entered_tree(Node *p_node);
+    void _on_child_exiting_tree(Node *p_node);
+    void _on_child_order_changed();
+    void _update_nodes();
+    void _sort_nodes();
+    void _renumber_nodes(uint32_t p_from);
+    void _update_view();
+    float _pick_resolution_scale(float p_screen_scale, int p_extent) const;
+    bool _crop_to_content(Rect2i &r_crop);
+    void _draw_nodes(rive::Renderer *renderer, const LocalVector<RiveNode*> &p_nodes, const Transform2D &p_transform, const Rect2 &p_cull_rect);
+    void _draw_tiled();
+    void _invalidate_tiles(const Rect2 &p_rect);
+    void _clear_tiles();
+    void _evict_tiles();
+    void _flush_spatial_index();
+    void _query_sorted(const Rect2 &p_rect, LocalVector<RiveNode*> &r_nodes);
 
 protected:
     static void _bind_methods();
@@ -33,13 +137,56 @@ public:
 
     void set_size(const Vector2i &p_size);
     Vector2i get_size() const;
+
+    void set_view_mode(ViewMode p_mode);
+    ViewMode get_view_mode() const;
+
+    void set_adaptive_resolution(bool p_enabled);
+    bool get_adaptive_resolution() const;
+    void set_min_resolution_scale(float p_scale);
+    float get_min_resolution_scale() const;
+    void set_max_resolution_scale(float p_scale);
+    float get_max_resolution_scale() const;
+    void set_resolution_hysteresis(float p_hysteresis);
+    float get_resolution_hysteresis() const;
+    float get_resolution_scale() const;
+
+    void set_tile_size(int p_size);
+    int get_tile_size() const;
+    void set_max_cached_tiles(int p_count);
+    int get_max_cached_tiles() const;
+    int get_cached_tile_count() const;
+
+    void set_advance_batch_size(int p_size);
+    int get_advance_batch_size() const;
+
+    void set_animation_lod(bool p_enabled);
+    bool get_animation_lod() const;
+    void set_lod_small_size(float p_size);
+    float get_lod_small_size() const;
+    void set_lod_tiny_size(float p_size);
+    float get_lod_tiny_size() const;
+
+    void set_max_render_fps(int p_fps);
+    int get_max_render_fps() const;
+
+    void set_spatial_cell_size(float p_size);
+    float get_spatial_cell_size() const;
+
+    void set_pointer_input(bool p_enabled);
+    bool get_pointer_input() const;
+
+    void _rive_node_bounds_changed(RiveNode *p_node) override;
     
     Ref<Texture2D> get_texture() const;
 
     void draw(rive::Renderer *renderer) override;
     
     void _process(double delta) override;
+    void _unhandled_input(const Ref<InputEvent> &p_event) override;
     void _draw() override;
 };
 
+VARIANT_ENUM_CAST(RiveCanvas2D::ViewMode);
+
 #endif // RIVE_CANVAS_2D_H
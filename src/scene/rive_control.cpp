@@ -1,4 +1,5 @@
 #include "rive_control.h"
+#include "rive_advance_scheduler.h"
 #include "../renderer/rive_renderer.h"
 #include "../rive_constants.h"
 #include <godot_cpp/classes/file_access.hpp>
@@ -6,6 +7,7 @@
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
 
 #include "rive/layout.hpp"
 #include <rive/viewmodel/viewmodel_instance_number.hpp>
@@ -44,6 +46,18 @@ void RiveControl::_bind_methods()
     ClassDB::bind_method(D_METHOD("set_enum_value", "property_path", "value"), &RiveControl::set_enum_value);
     ClassDB::bind_method(D_METHOD("set_color_value", "property_path", "value"), &RiveControl::set_color_value);
     ClassDB::bind_method(D_METHOD("get_view_model_instance"), &RiveControl::get_view_model_instance);
+    ClassDB::bind_method(D_METHOD("get_rive_player"), &RiveControl::get_rive_player);
+
+    ClassDB::bind_method(D_METHOD("set_pipelined_advance", "enabled"), &RiveControl::set_pipelined_advance);
+    ClassDB::bind_method(D_METHOD("is_pipelined_advance"), &RiveControl::is_pipelined_advance);
+
+    ClassDB::bind_method(D_METHOD("set_pause_when_hidden", "enabled"), &RiveControl::set_pause_when_hidden);
+    ClassDB::bind_method(D_METHOD("get_pause_when_hidden"), &RiveControl::get_pause_when_hidden);
+    ClassDB::bind_method(D_METHOD("set_hidden_release_delay", "seconds"), &RiveControl::set_hidden_release_delay);
+    ClassDB::bind_method(D_METHOD("get_hidden_release_delay"), &RiveControl::get_hidden_release_delay);
+    ClassDB::bind_method(D_METHOD("is_suspended"), &RiveControl::is_suspended);
+    ClassDB::bind_method(D_METHOD("set_max_render_fps", "fps"), &RiveControl::set_max_render_fps);
+    ClassDB::bind_method(D_METHOD("get_max_render_fps"), &RiveControl::get_max_render_fps);
 
     ClassDB::bind_method(D_METHOD("set_property_values", "values"), &RiveControl::set_property_values);
     ClassDB::bind_method(D_METHOD("get_property_values"), &RiveControl::get_property_values);
@@ -51,6 +65,10 @@ void RiveControl::_bind_methods()
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "rive_file", PROPERTY_HINT_RESOURCE_TYPE, "RiveFile"), "set_rive_file", "get_rive_file");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "animation_name"), "set_animation_name", "get_animation_name");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "state_machine_name"), "set_state_machine_name", "get_state_machine_name");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "pipelined_advance"), "set_pipelined_advance", "is_pipelined_advance");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_render_fps", PROPERTY_HINT_RANGE, "0,240,1,suffix:FPS"), "set_max_render_fps", "get_max_render_fps");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "pause_when_hidden"), "set_pause_when_hidden", "get_pause_when_hidden");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "hidden_release_delay", PROPERTY_HINT_RANGE, "0,60,0.1,or_greater,suffix:s"), "set_hidden_release_delay", "get_hidden_release_delay");
     ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "property_values", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "set_property_values", "get_property_values");
 }
 
@@ -74,9 +92,15 @@ void RiveControl::_notification(int p_what)
     {
     case NOTIFICATION_ENTER_TREE:
         load_file();
+        suspended = false;
+        hidden_time = 0.0;
+        _reset_cadence();
+        _update_advance_registration();
         set_process(true);
         break;
     case NOTIFICATION_EXIT_TREE:
+        RiveAdvanceScheduler::get_singleton()->remove_player(rive_player.ptr());
+        rive_player->finish_advance();
         break;
     case NOTIFICATION_RESIZED:
         break;
@@ -96,10 +120,69 @@ void RiveControl::_notification(int p_what)
     case NOTIFICATION_PROCESS:
         if (rive_player.is_valid())
         {
-            float delta = get_process_delta_time();
-            rive_player->advance(delta);
-            _render_rive();
-            queue_redraw();
+            double delta = get_process_delta_time();
+            bool on_screen = _is_on_screen();
+            _set_suspended(!on_screen);
+            if (on_screen)
+            {
+                hidden_time = 0.0;
+            }
+            else
+            {
+                hidden_time += delta;
+                if (hidden_time >= hidden_release_delay && texture_target.is_valid() && texture_target->is_valid())
+                {
+                    texture_target->clear();
+                    // Drop the draw command still pointing at the freed texture.
+                    queue_redraw();
+                }
+                if (pause_when_hidden)
+                    break;
+            }
+
+            if (max_render_fps > 0)
+            {
+                // Off cadence frames only bank their delta. Input and data writes don't wait.
+                rive_player->finish_advance();
+                pending_delta += delta;
+                cadence_time += delta;
+                double interval = 1.0 / max_render_fps;
+                bool due = cadence_time >= interval || (rive_player->has_external_change() && !rive_player->is_replaying());
+                if (cadence_time >= interval)
+                {
+                    cadence_time = Math::fmod(cadence_time, interval);
+                }
+                if (!due)
+                    break;
+                delta = pending_delta;
+                pending_delta = 0.0;
+            }
+
+            if (pipelined_advance)
+            {
+                // Draw what last frame's advance produced, then compute the next frame on a
+                // worker while the other controls and Godot encode this one.
+                rive_player->finish_advance();
+                if (on_screen)
+                    _render_rive();
+                rive_player->advance_async(delta);
+            }
+            else if (max_render_fps > 0)
+            {
+                // Off the shared schedule, one catch-up advance by everything banked.
+                rive_player->advance(delta);
+                if (on_screen)
+                    _render_rive();
+            }
+            else
+            {
+                // Advances the players of all RiveControls at once, ours included.
+                RiveAdvanceScheduler::get_singleton()->advance_frame(delta);
+                if (on_screen)
+                    _render_rive();
+            }
+            if (on_screen)
+                queue_redraw();
         }
         break;
     }
@@ -161,6 +244,7 @@ void RiveControl::load_file()
     PackedByteArray data = rive_file->get_data();
 
     if (rive_player.is_valid()) {
+        rive_player->set_memory_stats(rive_file->get_memory_stats());
         if (rive_player->load_from_bytes(data)) {
             _apply_property_values();
             notify_property_list_changed();
@@ -171,6 +255,122 @@ void RiveControl::load_file()
     }
 }
 
+void RiveControl::set_pipelined_advance(bool p_enabled)
+{
+    if (pipelined_advance == p_enabled)
+        return;
+
+    pipelined_advance = p_enabled;
+    if (!pipelined_advance)
+    {
+        rive_player->finish_advance();
+    }
+    _update_advance_registration();
+}
+
+bool RiveControl::is_pipelined_advance() const
+{
+    return pipelined_advance;
+}
+
+void RiveControl::set_pause_when_hidden(bool p_enabled)
+{
+    pause_when_hidden = p_enabled;
+    _update_advance_registration();
+}
+
+bool RiveControl::get_pause_when_hidden() const
+{
+    return pause_when_hidden;
+}
+
+void RiveControl::set_hidden_release_delay(float p_seconds)
+{
+    hidden_release_delay = MAX(0.0f, p_seconds);
+}
+
+float RiveControl::get_hidden_release_delay() const
+{
+    return hidden_release_delay;
+}
+
+bool RiveControl::is_suspended() const
+{
+    return suspended;
+}
+
+void RiveControl::set_max_render_fps(int p_fps)
+{
+    p_fps = MAX(0, p_fps);
+    if (max_render_fps == p_fps)
+        return;
+
+    max_render_fps = p_fps;
+    _reset_cadence();
+    _update_advance_registration();
+}
+
+int RiveControl::get_max_render_fps() const
+{
+    return max_render_fps;
+}
+
+// Starts the cadence at a fresh phase, so capped controls entering together render on different frames.
+void RiveControl::_reset_cadence()
+{
+    pending_delta = 0.0;
+    cadence_time = 0.0;
+    if (max_render_fps > 0)
+    {
+        cadence_time = RiveAdvanceScheduler::next_phase() / max_render_fps;
+    }
+}
+
+// Hidden in the tree, outside the viewport, or clipped away by a clip_contents ancestor
+// such as a ScrollContainer.
+bool RiveControl::_is_on_screen() const
+{
+    if (!is_visible_in_tree())
+        return false;
+
+    Rect2 rect = get_global_transform_with_canvas().xform(Rect2(Point2(), get_size()));
+    rect = rect.intersection(get_viewport_rect());
+    for (Control *parent = get_parent_control(); parent && rect.has_area(); parent = parent->get_parent_control())
+    {
+        if (parent->is_clipping_contents())
+        {
+            rect = rect.intersection(parent->get_global_transform_with_canvas().xform(Rect2(Point2(), parent->get_size())));
+        }
+    }
+    return rect.has_area();
+}
+
+void RiveControl::_set_suspended(bool p_suspended)
+{
+    if (suspended == p_suspended)
+        return;
+
+    suspended = p_suspended;
+    _update_advance_registration();
+}
+
+// The shared scheduler advances us unless we advance ourselves (pipelined) or are paused.
+void RiveControl::_update_advance_registration()
+{
+    if (!is_inside_tree())
+        return;
+
+    bool scheduled = !pipelined_advance && max_render_fps == 0 && !(suspended && pause_when_hidden);
+    if (scheduled)
+    {
+        RiveAdvanceScheduler::get_singleton()->add_player(rive_player.ptr(), this);
+    }
+    else
+    {
+        RiveAdvanceScheduler::get_singleton()->remove_player(rive_player.ptr());
+    }
+}
+
 void RiveControl::set_property_values(const Dictionary &p_values) {
     property_values = p_values;
     _apply_property_values();
@@ -212,7 +412,11 @@ bool RiveControl::_has_point(const Vector2 &p_point) const
 
 rive::Mat2D RiveControl::_get_rive_transform() const
 {
-    if (!rive_player.is_valid() || !rive_player->get_artboard())
+    if (!rive_player.is_valid())
+        return rive::Mat2D();
+    // Input and drawing both start here, the artboard must not be mid-advance.
+    rive_player->finish_advance();
+    if (!rive_player->get_artboard())
         return rive::Mat2D();
 
     Size2i size = get_size();
@@ -337,119 +541,24 @@ String RiveControl::get_state_machine_name() const
     return "";
 }
 
-static rive::ViewModelInstance *resolve_view_model_instance(rive::ViewModelInstance *root, const String &path, String &out_property_name)
-{
-    if (!root)
-        return nullptr;
-
-    PackedStringArray parts = path.split(".");
-    rive::ViewModelInstance *current = root;
-
-    for (int i = 0; i < parts.size() - 1; ++i)
-    {
-        rive::ViewModelInstanceValue *prop = current->propertyValue(parts[i].utf8().get_data());
-        if (!prop)
-            return nullptr;
-
-        rive::ViewModelInstanceViewModel *vm_prop = prop->as<rive::ViewModelInstanceViewModel>();
-        if (!vm_prop)
-            return nullptr;
-
-        current = vm_prop->referenceViewModelInstance().get();
-        if (!current)
-            return nullptr;
-    }
-
-    out_property_name = parts[parts.size() - 1];
-    return current;
-}
-
 void RiveControl::set_text_value(const String &p_property_path, const String &p_value)
 {
-    if (!rive_player.is_valid()) return;
-    rive::ViewModelInstance *vm = rive_player->get_view_model_instance();
-    if (!vm) return;
-
-    String prop_name;
-    rive::ViewModelInstance *target_vm = resolve_view_model_instance(vm, p_property_path, prop_name);
-
-    if (target_vm)
-    {
-        rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
-        if (prop)
-        {
-            if (prop->is<rive::ViewModelInstanceString>())
-            {
-                prop->as<rive::ViewModelInstanceString>()->propertyValue(std::string(p_value.utf8().get_data()));
-            }
-        }
-    }
+    if (rive_player.is_valid()) rive_player->set_view_model_value(p_property_path, p_value);
 }
 
 void RiveControl::set_number_value(const String &p_property_path, float p_value)
 {
-    if (!rive_player.is_valid()) return;
-    rive::ViewModelInstance *vm = rive_player->get_view_model_instance();
-    if (!vm) return;
-
-    String prop_name;
-    rive::ViewModelInstance *target_vm = resolve_view_model_instance(vm, p_property_path, prop_name);
-
-    if (target_vm)
-    {
-        rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
-        if (prop)
-        {
-            if (prop->is<rive::ViewModelInstanceNumber>())
-            {
-                prop->as<rive::ViewModelInstanceNumber>()->propertyValue(p_value);
-            }
-        }
-    }
+    if (rive_player.is_valid()) rive_player->set_view_model_value(p_property_path, p_value);
 }
 
 void RiveControl::set_boolean_value(const String &p_property_path, bool p_value)
 {
-    if (!rive_player.is_valid()) return;
-    rive::ViewModelInstance *vm = rive_player->get_view_model_instance();
-    if (!vm) return;
-
-    String prop_name;
-    rive::ViewModelInstance *target_vm = resolve_view_model_instance(vm, p_property_path, prop_name);
-
-    if (target_vm)
-    {
-        rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
-        if (prop)
-        {
-            if (prop->is<rive::ViewModelInstanceBoolean>())
-            {
-                prop->as<rive::ViewModelInstanceBoolean>()->propertyValue(p_value);
-            }
-        }
-    }
+    if (rive_player.is_valid()) rive_player->set_view_model_value(p_property_path, p_value);
 }
 
 void RiveControl::fire_trigger(const String &p_property_path)
 {
-    if (!rive_player.is_valid()) return;
-    rive::ViewModelInstance *vm = rive_player->get_view_model_instance();
-    if (!vm) return;
-
-    String prop_name;
-    rive::ViewModelInstance *target_vm = resolve_view_model_instance(vm, p_property_path, prop_name);
-
-    if (target_vm)
-    {
-        rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
-        if (prop)
-        {
-            if (prop->is<rive::ViewModelInstanceTrigger>())
-            {
-                prop->as<rive::ViewModelInstanceTrigger>()->trigger();
-            }
-        }
-    }
+    if (rive_player.is_valid()) rive_player->fire_view_model_trigger(p_property_path);
 }
 
 void RiveControl::_get_property_list(List<PropertyInfo> *p_list) const
@@ -471,11 +580,12 @@ bool RiveControl::_get(const StringName &p_name, Variant &r_ret) const
         }
 
         if (!rive_player.is_valid()) return false;
+        rive_player->finish_advance();
         rive::ViewModelInstance *vm = rive_player->get_view_model_instance();
         if (!vm) return false;
 
         String prop_name;
-        rive::ViewModelInstance *target_vm = resolve_view_model_instance(vm, path, prop_name);
+        rive::ViewModelInstance *target_vm = RivePlayer::resolve_view_model_instance(vm, path, prop_name);
 
         if (target_vm)
         {
@@ -547,51 +657,12 @@ bool RiveControl::_set(const StringName &p_name, const Variant &p_value)
 
 void RiveControl::set_enum_value(const String &p_property_path, int p_value)
 {
-    if (!rive_player.is_valid()) return;
-    rive::ViewModelInstance *vm = rive_player->get_view_model_instance();
-    if (!vm) return;
-
-    String prop_name;
-    rive::ViewModelInstance *target_vm = resolve_view_model_instance(vm, p_property_path, prop_name);
-
-    if (target_vm)
-    {
-        rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
-        if (prop)
-        {
-            if (prop->is<rive::ViewModelInstanceEnum>())
-            {
-                prop->as<rive::ViewModelInstanceEnum>()->value((uint32_t)p_value);
-            }
-        }
-    }
+    if (rive_player.is_valid()) rive_player->set_view_model_value(p_property_path, p_value);
 }
 
 void RiveControl::set_color_value(const String &p_property_path, Color p_value)
 {
-    if (!rive_player.is_valid()) return;
-    rive::ViewModelInstance *vm = rive_player->get_view_model_instance();
-    if (!vm) return;
-
-    String prop_name;
-    rive::ViewModelInstance *target_vm = resolve_view_model_instance(vm, p_property_path, prop_name);
-
-    if (target_vm)
-    {
-        rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
-        if (prop)
-        {
-            if (prop->is<rive::ViewModelInstanceColor>())
-            {
-                uint32_t a = (uint32_t)(p_value.a * 255.0f);
-                uint32_t r = (uint32_t)(p_value.r * 255.0f);
-                uint32_t g = (uint32_t)(p_value.g * 255.0f);
-                uint32_t b = (uint32_t)(p_value.b * 255.0f);
-                uint32_t argb = (a << 24) | (r << 16) | (g << 8) | b;
-                prop->as<rive::ViewModelInstanceColor>()->propertyValue(argb);
-            }
-        }
-    }
+    if (rive_player.is_valid()) rive_player->set_view_model_value(p_property_path, p_value);
 }
 
 Ref<RiveViewModelInstance> RiveControl::get_view_model_instance() const {
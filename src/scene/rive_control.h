@@ -24,6 +24,20 @@ class RiveControl : public Control, public RiveDrawable
     Ref<RivePlayer> rive_player;
     Ref<RiveTextureTarget> texture_target;
     Dictionary property_values;
+    // Advance on a worker after rendering instead of before, one frame behind.
+    bool pipelined_advance = false;
+
+    // Off screen (hidden, scrolled or clipped away) nothing is rendered. The player is paused too
+    // unless pause_when_hidden is off, and the texture is freed after hidden_release_delay seconds.
+    bool pause_when_hidden = true;
+    float hidden_release_delay = 2.0f;
+    bool suspended = false;
+    double hidden_time = 0.0;
+
+    // 0 renders every frame. Otherwise delta is banked and spent in one advance per render.
+    int max_render_fps = 0;
+    double cadence_time = 0.0;
+    double pending_delta = 0.0;
 
     struct RiveProperty
     {
@@ -50,6 +64,10 @@ protected:
     rive::Mat2D _get_rive_transform() const;
     void _apply_property_values();
     void _on_rive_file_changed();
+    bool _is_on_screen() const;
+    void _set_suspended(bool p_suspended);
+    void _update_advance_registration();
+    void _reset_cadence();
 
 public:
     RiveControl();
@@ -58,6 +76,16 @@ public:
     void set_rive_file(const Ref<RiveFile> &p_file);
     Ref<RiveFile> get_rive_file() const;
 
+    void set_pipelined_advance(bool p_enabled);
+    bool is_pipelined_advance() const;
+    void set_pause_when_hidden(bool p_enabled);
+    bool get_pause_when_hidden() const;
+    void set_hidden_release_delay(float p_seconds);
+    float get_hidden_release_delay() const;
+    bool is_suspended() const;
+    void set_max_render_fps(int p_fps);
+    int get_max_render_fps() const;
+
     void set_property_values(const Dictionary &p_values);
     Dictionary get_property_values() const;
 
@@ -18,6 +18,7 @@ void RiveFileInstance::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_auto_play", "auto_play"), &RiveFileInstance::set_auto_play);
     ClassDB::bind_method(D_METHOD("get_auto_play"), &RiveFileInstance::get_auto_play);
     ClassDB::bind_method(D_METHOD("get_view_model_instance"), &RiveFileInstance::get_view_model_instance);
+    ClassDB::bind_method(D_METHOD("adopt_artboard", "handle"), &RiveFileInstance::adopt_artboard);
 
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "rive_file", PROPERTY_HINT_RESOURCE_TYPE, "RiveFile"), "set_rive_file", "get_rive_file");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "artboard_name"), "set_artboard_name", "get_artboard_name");
@@ -35,15 +36,24 @@ RiveFileInstance::~RiveFileInstance() {
 
 void RiveFileInstance::_notification(int p_what) {
     switch (p_what) {
-        case NOTIFICATION_READY:
-            _load_artboard();
+        case NOTIFICATION_ENTER_TREE:
+            // Setters only load inside the tree, so a spawned node acquires one bundle here
+            // with its final configuration. adopt_artboard() may have provided it already.
+            if (!_is_bundle_current()) {
+                _load_artboard();
+            }
+            break;
+        case NOTIFICATION_PREDELETE:
+            _release_bundle();
             break;
     }
 }
 
 void RiveFileInstance::set_rive_file(const Ref<RiveFile> &p_file) {
     rive_file_resource = p_file;
-    _load_artboard();
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
     queue_redraw();
 }
 
@@ -53,7 +63,9 @@ Ref<RiveFile> RiveFileInstance::get_rive_file() const {
 
 void RiveFileInstance::set_artboard_name(const String &p_name) {
     artboard_name = p_name;
-    _load_artboard();
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
     queue_redraw();
 }
 
@@ -63,7 +75,9 @@ String RiveFileInstance::get_artboard_name() const {
 
 void RiveFileInstance::set_state_machine_name(const String &p_name) {
     state_machine_name = p_name;
-    _load_artboard();
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
 }
 
 String RiveFileInstance::get_state_machine_name() const {
@@ -72,7 +86,9 @@ String RiveFileInstance::get_state_machine_name() const {
 
 void RiveFileInstance::set_animation_name(const String &p_name) {
     animation_name = p_name;
-    _load_artboard();
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
 }
 
 String RiveFileInstance::get_animation_name() const {
@@ -91,22 +107,72 @@ void RiveFileInstance::_load_artboard() {
     if (rive_file_resource.is_null()) return;
     if (!rive_player.is_valid()) return;
     
-    std::unique_ptr<rive::ArtboardInstance> artboard = rive_file_resource->instantiate_artboard(artboard_name);
+    _release_bundle();
+
+    // Pooled when the file was prewarmed for this combination, see RiveFile::prewarm().
+    std::unique_ptr<RiveBundle> bundle = rive_file_resource->acquire_bundle(artboard_name, state_machine_name, animation_name);
 
-    if (!artboard) return;
+    if (!bundle) return;
 
     rive::rcp<rive::File> file;
     if (rive_file_resource->get_rive_file()) {
-        file = rive::rcp<rive::File>(rive_file_resource->get_rive_file());
+        file = rive::ref_rcp(rive_file_resource->get_rive_file());
     }
 
-    rive_player->set_artboard(std::move(artboard), file);
+    rive_player->set_memory_stats(rive_file_resource->get_memory_stats());
+    rive_player->adopt_bundle(std::move(bundle), file);
+    bundle_file = rive_file_resource;
+    bundle_artboard = artboard_name;
+    bundle_state_machine = state_machine_name;
+    bundle_animation = animation_name;
+    _rive_bounds_changed();
+}
+
+// Outside the tree the setters defer loading to ENTER_TREE. Scripts that configure a node and
+// read from it before add_child() still get an artboard, entering the tree then keeps it.
+void RiveFileInstance::_load_on_demand() const {
+    if (is_inside_tree() || _is_bundle_current()) return;
+    const_cast<RiveFileInstance *>(this)->_load_artboard();
+}
+
+bool RiveFileInstance::_is_bundle_current() const {
+    return bundle_file.is_valid() && bundle_file == rive_file_resource && bundle_artboard == artboard_name
+            && bundle_state_machine == state_machine_name && bundle_animation == animation_name;
+}
+
+// Takes over an artboard built by RiveFile.instantiate_many(), along with its file and names.
+void RiveFileInstance::adopt_artboard(const Ref<RiveArtboardHandle> &p_handle) {
+    ERR_FAIL_COND(p_handle.is_null() || !p_handle->is_valid());
+    if (!rive_player.is_valid()) return;
+
+    _release_bundle();
 
-    if (!state_machine_name.is_empty()) {
-        rive_player->play_state_machine(state_machine_name);
-    } else if (!animation_name.is_empty()) {
-        rive_player->play_animation(animation_name);
+    rive_file_resource = p_handle->get_rive_file();
+    artboard_name = p_handle->get_artboard_name();
+    state_machine_name = p_handle->get_state_machine_name();
+    animation_name = p_handle->get_animation_name();
+
+    rive::rcp<rive::File> file;
+    if (rive_file_resource->get_rive_file()) {
+        file = rive::ref_rcp(rive_file_resource->get_rive_file());
     }
+
+    rive_player->set_memory_stats(rive_file_resource->get_memory_stats());
+    rive_player->adopt_bundle(p_handle->take_bundle(), file);
+    bundle_file = rive_file_resource;
+    bundle_artboard = artboard_name;
+    bundle_state_machine = state_machine_name;
+    bundle_animation = animation_name;
+    _rive_bounds_changed();
+    queue_redraw();
+}
+
+void RiveFileInstance::_release_bundle() {
+    if (bundle_file.is_null()) return;
+    if (rive_player.is_valid()) {
+        bundle_file->release_bundle(bundle_artboard, bundle_state_machine, bundle_animation, rive_player->release_bundle());
+    }
+    bundle_file.unref();
 }
 
 void RiveFileInstance::advance(double delta) {
@@ -133,6 +199,7 @@ void RiveFileInstance::draw(rive::Renderer *renderer) {
 }
 
 Rect2 RiveFileInstance::get_rive_bounds() const {
+    _load_on_demand();
     if (rive_player.is_valid() && rive_player->get_artboard()) {
         rive::AABB aabb = rive_player->get_artboard()->bounds();
         return Rect2(aabb.minX, aabb.minY, aabb.width(), aabb.height());
@@ -140,6 +207,15 @@ Rect2 RiveFileInstance::get_rive_bounds() const {
     return Rect2();
 }
 
+bool RiveFileInstance::is_animating() const {
+    return rive_player.is_valid() && rive_player->is_animating();
+}
+
+// Only while advance() passes changes on, the flag is cleared by the player's next advance.
+bool RiveFileInstance::has_external_change() const {
+    return auto_play && rive_player.is_valid() && !rive_player->is_replaying() && rive_player->has_external_change();
+}
+
 bool RiveFileInstance::hit_test(Vector2 point) {
     if (rive_player.is_valid()) {
         Transform2D xform = get_transform();
@@ -153,7 +229,7 @@ bool RiveFileInstance::hit_test(Vector2 point) {
     return false; 
 }
 
-void RiveFileInstance::pointer_down(Vector2 position) {
+bool RiveFileInstance::pointer_down(Vector2 position) {
     if (rive_player.is_valid()) {
         Transform2D xform = get_transform();
         rive::Mat2D rive_transform(
@@ -161,11 +237,12 @@ void RiveFileInstance::pointer_down(Vector2 position) {
             xform.columns[1].x, xform.columns[1].y,
             xform.columns[2].x, xform.columns[2].y
         );
-        rive_player->pointer_down(position, rive_transform);
+        return rive_player->pointer_down(position, rive_transform);
     }
+    return false;
 }
 
-void RiveFileInstance::pointer_up(Vector2 position) {
+bool RiveFileInstance::pointer_up(Vector2 position) {
     if (rive_player.is_valid()) {
         Transform2D xform = get_transform();
         rive::Mat2D rive_transform(
@@ -173,11 +250,12 @@ void RiveFileInstance::pointer_up(Vector2 position) {
             xform.columns[1].x, xform.columns[1].y,
             xform.columns[2].x, xform.columns[2].y
         );
-        rive_player->pointer_up(position, rive_transform);
+        return rive_player->pointer_up(position, rive_transform);
     }
+    return false;
 }
 
-void RiveFileInstance::pointer_move(Vector2 position) {
+bool RiveFileInstance::pointer_move(Vector2 position) {
     if (rive_player.is_valid()) {
         Transform2D xform = get_transform();
         rive::Mat2D rive_transform(
@@ -185,11 +263,13 @@ void RiveFileInstance::pointer_move(Vector2 position) {
             xform.columns[1].x, xform.columns[1].y,
             xform.columns[2].x, xform.columns[2].y
         );
-        rive_player->pointer_move(position, rive_transform);
+        return rive_player->pointer_move(position, rive_transform);
     }
+    return false;
 }
 
 Ref<RiveViewModelInstance> RiveFileInstance::get_view_model_instance() const {
+    _load_on_demand();
     if (rive_player.is_valid()) {
         return rive_player->get_rive_view_model_instance();
     }
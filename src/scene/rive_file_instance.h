@@ -4,6 +4,7 @@
 #include "rive_node.h"
 #include "../resources/rive_file.h"
 #include "rive_player.h"
+#include "../resources/rive_artboard_handle.h"
 
 using namespace godot;
 
@@ -20,7 +21,16 @@ private:
     
     bool auto_play = true;
 
+    // Where the player's bundle came from, so it can go back to that file's pool.
+    Ref<RiveFile> bundle_file;
+    String bundle_artboard;
+    String bundle_state_machine;
+    String bundle_animation;
+
     void _load_artboard();
+    void _release_bundle();
+    bool _is_bundle_current() const;
+    void _load_on_demand() const;
 
 protected:
     static void _bind_methods();
@@ -45,15 +55,19 @@ public:
     void set_auto_play(bool p_auto);
     bool get_auto_play() const;
 
+    void adopt_artboard(const Ref<RiveArtboardHandle> &p_handle);
+
     void advance(double delta) override;
     void draw(rive::Renderer *renderer) override;
     Rect2 get_rive_bounds() const override;
+    bool is_animating() const override;
+    bool has_external_change() const override;
     
     bool hit_test(Vector2 point);
 
-    void pointer_down(Vector2 position) override;
-    void pointer_up(Vector2 position) override;
-    void pointer_move(Vector2 position) override;
+    bool pointer_down(Vector2 position) override;
+    bool pointer_up(Vector2 position) override;
+    bool pointer_move(Vector2 position) override;
 
     Ref<RiveViewModelInstance> get_view_model_instance() const;
 };
@@ -1,6 +1,31 @@
 #include "rive_multi_instance.h"
+#include "../rive_profiler.h"
+#include "../renderer/rive_renderer.h"
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+#include <godot_cpp/classes/physics_server2d.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <rive/animation/linear_animation.hpp>
+#include <rive/animation/loop.hpp>
+#include <cfloat>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RIVE_MULTI_INSTANCE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Instances advanced per worker pool task.
+static const uint32_t INSTANCE_BATCH_SIZE = 32;
+// MultiMesh TRANSFORM_2D stride: x axis x, y axis x, padding, origin x, then the same for y.
+static const int MULTIMESH_FLOATS_PER_INSTANCE = 8;
+// Largest impostor texture side, whatever the tier.
+static const int MAX_IMPOSTOR_PIXELS = 4096;
 
 void RiveMultiInstance::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_rive_file", "file"), &RiveMultiInstance::set_rive_file);
@@ -21,17 +46,57 @@ void RiveMultiInstance::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_transforms", "transforms"), &RiveMultiInstance::set_transforms);
     ClassDB::bind_method(D_METHOD("get_transforms"), &RiveMultiInstance::get_transforms);
 
+    ClassDB::bind_method(D_METHOD("set_instance_count", "count"), &RiveMultiInstance::set_instance_count);
+    ClassDB::bind_method(D_METHOD("get_instance_count"), &RiveMultiInstance::get_instance_count);
+    ClassDB::bind_method(D_METHOD("set_instance_transforms", "data"), &RiveMultiInstance::set_instance_transforms);
+    ClassDB::bind_method(D_METHOD("get_instance_transforms"), &RiveMultiInstance::get_instance_transforms);
+    ClassDB::bind_method(D_METHOD("set_instance_positions", "positions"), &RiveMultiInstance::set_instance_positions);
+    ClassDB::bind_method(D_METHOD("set_instance_transform", "index", "transform"), &RiveMultiInstance::set_instance_transform);
+    ClassDB::bind_method(D_METHOD("get_instance_transform", "index"), &RiveMultiInstance::get_instance_transform);
+    ClassDB::bind_method(D_METHOD("set_instance_position", "index", "position"), &RiveMultiInstance::set_instance_position);
+
+    ClassDB::bind_method(D_METHOD("set_per_instance_state", "enabled"), &RiveMultiInstance::set_per_instance_state);
+    ClassDB::bind_method(D_METHOD("get_per_instance_state"), &RiveMultiInstance::get_per_instance_state);
+    ClassDB::bind_method(D_METHOD("set_instance_speed", "index", "speed"), &RiveMultiInstance::set_instance_speed);
+    ClassDB::bind_method(D_METHOD("get_instance_speed", "index"), &RiveMultiInstance::get_instance_speed);
+    ClassDB::bind_method(D_METHOD("set_instance_speeds", "speeds"), &RiveMultiInstance::set_instance_speeds);
+    ClassDB::bind_method(D_METHOD("get_instance_speeds"), &RiveMultiInstance::get_instance_speeds);
+    ClassDB::bind_method(D_METHOD("set_instance_time_offset", "index", "offset"), &RiveMultiInstance::set_instance_time_offset);
+    ClassDB::bind_method(D_METHOD("get_instance_time_offset", "index"), &RiveMultiInstance::get_instance_time_offset);
+    ClassDB::bind_method(D_METHOD("set_instance_time_offsets", "offsets"), &RiveMultiInstance::set_instance_time_offsets);
+    ClassDB::bind_method(D_METHOD("get_instance_time_offsets"), &RiveMultiInstance::get_instance_time_offsets);
+
+    ClassDB::bind_method(D_METHOD("set_impostor_mode", "enabled"), &RiveMultiInstance::set_impostor_mode);
+    ClassDB::bind_method(D_METHOD("get_impostor_mode"), &RiveMultiInstance::get_impostor_mode);
+    ClassDB::bind_method(D_METHOD("set_impostor_max_size", "size"), &RiveMultiInstance::set_impostor_max_size);
+    ClassDB::bind_method(D_METHOD("get_impostor_max_size"), &RiveMultiInstance::get_impostor_max_size);
+
+    ClassDB::bind_method(D_METHOD("set_source_nodes", "nodes"), &RiveMultiInstance::set_source_nodes);
+    ClassDB::bind_method(D_METHOD("get_source_nodes"), &RiveMultiInstance::get_source_nodes);
+    ClassDB::bind_method(D_METHOD("set_source_bodies", "bodies"), &RiveMultiInstance::set_source_bodies);
+    ClassDB::bind_method(D_METHOD("get_source_bodies"), &RiveMultiInstance::get_source_bodies);
+    ClassDB::bind_method(D_METHOD("clear_sources"), &RiveMultiInstance::clear_sources);
+
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "rive_file", PROPERTY_HINT_RESOURCE_TYPE, "RiveFile"), "set_rive_file", "get_rive_file");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "artboard_name"), "set_artboard_name", "get_artboard_name");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "state_machine_name"), "set_state_machine_name", "get_state_machine_name");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "animation_name"), "set_animation_name", "get_animation_name");
     ADD_PROPERTY(PropertyInfo(Variant::BOOL, "auto_play"), "set_auto_play", "get_auto_play");
     ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "transforms", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT), "set_transforms", "get_transforms");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "instance_count", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_instance_count", "get_instance_count");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "per_instance_state"), "set_per_instance_state", "get_per_instance_state");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "instance_speeds"), "set_instance_speeds", "get_instance_speeds");
+    ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "instance_time_offsets"), "set_instance_time_offsets", "get_instance_time_offsets");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "impostor_mode"), "set_impostor_mode", "get_impostor_mode");
+    ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "impostor_max_size", PROPERTY_HINT_RANGE, "8,1024,1,suffix:px"), "set_impostor_max_size", "get_impostor_max_size");
 }
 
-RiveMultiInstance::RiveMultiInstance() {}
+RiveMultiInstance::RiveMultiInstance() {
+    impostor_drawable.owner = this;
+}
 
 RiveMultiInstance::~RiveMultiInstance() {
+    _clear_instance_state();
     artboard.reset();
     state_machine.reset();
     animation.reset();
@@ -39,15 +104,33 @@ RiveMultiInstance::~RiveMultiInstance() {
 
 void RiveMultiInstance::_notification(int p_what) {
     switch (p_what) {
-        case NOTIFICATION_READY:
-            _load_artboard();
+        case NOTIFICATION_ENTER_TREE:
+            if (artboard_dirty) {
+                _load_artboard();
+            } else {
+                // Picks up per-instance state skipped or dropped while out of the tree.
+                _sync_instance_state();
+            }
+            break;
+        case NOTIFICATION_INTERNAL_PROCESS:
+            _sync_sources();
+            break;
+        case NOTIFICATION_PROCESS:
+            // Impostors follow the animation and the on-screen scale, redraw every frame.
+            queue_redraw();
+            break;
+        case NOTIFICATION_DRAW:
+            _draw_impostors();
             break;
     }
 }
 
 void RiveMultiInstance::set_rive_file(const Ref<RiveFile> &p_file) {
     rive_file_resource = p_file;
-    _load_artboard();
+    artboard_dirty = true;
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
     queue_redraw();
 }
 
@@ -57,7 +140,10 @@ Ref<RiveFile> RiveMultiInstance::get_rive_file() const {
 
 void RiveMultiInstance::set_artboard_name(const String &p_name) {
     artboard_name = p_name;
-    _load_artboard();
+    artboard_dirty = true;
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
     queue_redraw();
 }
 
@@ -67,7 +153,10 @@ String RiveMultiInstance::get_artboard_name() const {
 
 void RiveMultiInstance::set_state_machine_name(const String &p_name) {
     state_machine_name = p_name;
-    _load_artboard();
+    artboard_dirty = true;
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
 }
 
 String RiveMultiInstance::get_state_machine_name() const {
@@ -76,7 +165,10 @@ String RiveMultiInstance::get_state_machine_name() const {
 
 void RiveMultiInstance::set_animation_name(const String &p_name) {
     animation_name = p_name;
-    _load_artboard();
+    artboard_dirty = true;
+    if (is_inside_tree()) {
+        _load_artboard();
+    }
 }
 
 String RiveMultiInstance::get_animation_name() const {
@@ -92,39 +184,404 @@ bool RiveMultiInstance::get_auto_play() const {
 }
 
 void RiveMultiInstance::set_transforms(const Array &p_transforms) {
-    transforms = p_transforms;
-    queue_redraw();
+    instance_data.resize(p_transforms.size() * FLOATS_PER_INSTANCE);
+    for (int i = 0; i < p_transforms.size(); i++) {
+        Transform2D t = p_transforms[i];
+        float *d = instance_data.ptr() + i * FLOATS_PER_INSTANCE;
+        d[0] = t.columns[0].x;
+        d[1] = t.columns[0].y;
+        d[2] = t.columns[1].x;
+        d[3] = t.columns[1].y;
+        d[4] = t.columns[2].x;
+        d[5] = t.columns[2].y;
+    }
+    _transforms_changed();
 }
 
 Array RiveMultiInstance::get_transforms() const {
+    Array transforms;
+    transforms.resize(get_instance_count());
+    for (int i = 0; i < get_instance_count(); i++) {
+        transforms[i] = get_instance_transform(i);
+    }
     return transforms;
 }
 
+void RiveMultiInstance::_transforms_changed() {
+    instance_bounds_dirty = true;
+    _sync_instance_state();
+    _rive_bounds_changed();
+    queue_redraw();
+}
+
+rive::Mat2D RiveMultiInstance::_get_instance_mat(uint32_t p_index) const {
+    const float *d = instance_data.ptr() + p_index * FLOATS_PER_INSTANCE;
+    return rive::Mat2D(d[0], d[1], d[2], d[3], d[4], d[5]);
+}
+
+void RiveMultiInstance::set_instance_count(int p_count) {
+    ERR_FAIL_COND(p_count < 0);
+    uint32_t old_count = get_instance_count();
+    instance_data.resize(p_count * FLOATS_PER_INSTANCE);
+
+    // New instances start at the node origin.
+    for (uint32_t i = old_count; i < (uint32_t)p_count; i++) {
+        float *d = instance_data.ptr() + i * FLOATS_PER_INSTANCE;
+        d[0] = 1.0f;
+        d[1] = 0.0f;
+        d[2] = 0.0f;
+        d[3] = 1.0f;
+        d[4] = 0.0f;
+        d[5] = 0.0f;
+    }
+    _transforms_changed();
+}
+
+int RiveMultiInstance::get_instance_count() const {
+    return instance_data.size() / FLOATS_PER_INSTANCE;
+}
+
+// p_data holds FLOATS_PER_INSTANCE floats per instance: x axis, y axis, origin.
+void RiveMultiInstance::set_instance_transforms(const PackedFloat32Array &p_data) {
+    ERR_FAIL_COND_MSG(p_data.size() % FLOATS_PER_INSTANCE != 0, "RiveMultiInstance: Transform data must hold 6 floats per instance.");
+    instance_data.resize(p_data.size());
+    if (p_data.size() > 0) {
+        memcpy(instance_data.ptr(), p_data.ptr(), p_data.size() * sizeof(float));
+    }
+    _transforms_changed();
+}
+
+PackedFloat32Array RiveMultiInstance::get_instance_transforms() const {
+    PackedFloat32Array data;
+    data.resize(instance_data.size());
+    if (instance_data.size() > 0) {
+        memcpy(data.ptrw(), instance_data.ptr(), instance_data.size() * sizeof(float));
+    }
+    return data;
+}
+
+// Resizes to the number of positions, every instance becomes an unrotated, unscaled translation.
+void RiveMultiInstance::set_instance_positions(const PackedVector2Array &p_positions) {
+    instance_data.resize(p_positions.size() * FLOATS_PER_INSTANCE);
+    const Vector2 *src = p_positions.ptr();
+    for (int64_t i = 0; i < p_positions.size(); i++) {
+        float *d = instance_data.ptr() + i * FLOATS_PER_INSTANCE;
+        d[0] = 1.0f;
+        d[1] = 0.0f;
+        d[2] = 0.0f;
+        d[3] = 1.0f;
+        d[4] = src[i].x;
+        d[5] = src[i].y;
+    }
+    _transforms_changed();
+}
+
+void RiveMultiInstance::set_instance_transform(int p_index, const Transform2D &p_transform) {
+    ERR_FAIL_INDEX(p_index, get_instance_count());
+    float *d = instance_data.ptr() + p_index * FLOATS_PER_INSTANCE;
+    d[0] = p_transform.columns[0].x;
+    d[1] = p_transform.columns[0].y;
+    d[2] = p_transform.columns[1].x;
+    d[3] = p_transform.columns[1].y;
+    d[4] = p_transform.columns[2].x;
+    d[5] = p_transform.columns[2].y;
+    _transforms_changed();
+}
+
+Transform2D RiveMultiInstance::get_instance_transform(int p_index) const {
+    ERR_FAIL_INDEX_V(p_index, get_instance_count(), Transform2D());
+    const float *d = instance_data.ptr() + p_index * FLOATS_PER_INSTANCE;
+    return Transform2D(Vector2(d[0], d[1]), Vector2(d[2], d[3]), Vector2(d[4], d[5]));
+}
+
+void RiveMultiInstance::set_instance_position(int p_index, const Vector2 &p_position) {
+    ERR_FAIL_INDEX(p_index, get_instance_count());
+    float *d = instance_data.ptr() + p_index * FLOATS_PER_INSTANCE;
+    d[4] = p_position.x;
+    d[5] = p_position.y;
+    _transforms_changed();
+}
+
 void RiveMultiInstance::_load_artboard() {
+    artboard_dirty = false;
     if (rive_file_resource.is_null()) return;
     
     artboard.reset();
     state_machine.reset();
     animation.reset();
+    artboard_memory.release();
+    state_machine_memory.release();
+    shared_time = 0.0;
+
+    _clear_instance_state();
 
     artboard = rive_file_resource->instantiate_artboard(artboard_name);
+    animating = true;
+    instance_bounds_dirty = true;
+    impostor_valid = false;
+    _rive_bounds_changed();
 
     if (!artboard) return;
 
+    _create_playback(artboard.get(), state_machine, animation);
+    artboard->advance(0.0f);
+
+    const std::shared_ptr<RiveMemoryStats> &stats = rive_file_resource->get_memory_stats();
+    artboard_memory.track(stats, RiveMemoryStats::ARTBOARDS, rive_memory::estimate_artboard(artboard.get()));
+    if (state_machine) {
+        state_machine_memory.track(stats, RiveMemoryStats::STATE_MACHINES, rive_memory::estimate_state_machine(state_machine.get()));
+    } else {
+        state_machine_memory.release();
+    }
+
+    _sync_instance_state();
+    _instance_time_changed();
+}
+
+void RiveMultiInstance::_create_playback(rive::ArtboardInstance *p_artboard, std::unique_ptr<rive::StateMachineInstance> &r_state_machine, std::unique_ptr<rive::LinearAnimationInstance> &r_animation) const {
     if (!state_machine_name.is_empty()) {
-        state_machine = artboard->stateMachineNamed(state_machine_name.utf8().get_data());
-    } else if (artboard->stateMachineCount() > 0) {
-        state_machine = artboard->stateMachineAt(0); 
+        r_state_machine = p_artboard->stateMachineNamed(state_machine_name.utf8().get_data());
+    } else if (p_artboard->stateMachineCount() > 0) {
+        r_state_machine = p_artboard->stateMachineAt(0);
     }
 
-    if (!state_machine && !animation_name.is_empty()) {
-        animation = artboard->animationNamed(animation_name.utf8().get_data());
-    } else if (!state_machine && artboard->animationCount() > 0) {
-        animation = artboard->animationAt(0);
+    if (!r_state_machine && !animation_name.is_empty()) {
+        r_animation = p_artboard->animationNamed(animation_name.utf8().get_data());
+    } else if (!r_state_machine && p_artboard->animationCount() > 0) {
+        r_animation = p_artboard->animationAt(0);
     }
-    
-    if (artboard) {
-        artboard->advance(0.0f);
+}
+
+// Builds the playback of one instance from scratch and fast-forwards it by its time offset.
+void RiveMultiInstance::_create_instance_state(uint32_t p_index) {
+    std::unique_ptr<rive::ArtboardInstance> &instance_artboard = instance_artboards[p_index];
+    instance_state_machines[p_index].reset();
+    instance_animations[p_index].reset();
+    instance_artboard = rive_file_resource->instantiate_artboard(artboard_name);
+    instance_animating[p_index] = 1;
+    if (!instance_artboard) return;
+
+    _create_playback(instance_artboard.get(), instance_state_machines[p_index], instance_animations[p_index]);
+
+    float offset = instance_time_offsets[p_index];
+    if (instance_state_machines[p_index]) {
+        instance_state_machines[p_index]->advance(offset);
+    } else if (instance_animations[p_index]) {
+        instance_animations[p_index]->advance(offset);
+        instance_animations[p_index]->apply();
+    }
+    instance_artboard->advance(offset);
+
+    const std::shared_ptr<RiveMemoryStats> &stats = rive_file_resource->get_memory_stats();
+    instance_artboard_memory[p_index].track(stats, RiveMemoryStats::ARTBOARDS, rive_memory::estimate_artboard(instance_artboard.get()));
+    if (instance_state_machines[p_index]) {
+        instance_state_machine_memory[p_index].track(stats, RiveMemoryStats::STATE_MACHINES, rive_memory::estimate_state_machine(instance_state_machines[p_index].get()));
+    } else {
+        instance_state_machine_memory[p_index].release();
+    }
+}
+
+// Matches the per-instance arrays to the transform count, creating or dropping playback as needed.
+void RiveMultiInstance::_sync_instance_state() {
+    uint32_t count = get_instance_count();
+    uint32_t old_count = instance_speeds.size();
+    if (old_count != count) {
+        instance_speeds.resize(count);
+        instance_time_offsets.resize(count);
+        instance_animating.resize(count);
+        for (uint32_t i = old_count; i < count; i++) {
+            instance_speeds[i] = 1.0f;
+            instance_time_offsets[i] = 0.0f;
+            instance_animating[i] = 1;
+        }
+    }
+
+    if (!per_instance_state || !artboard) {
+        _clear_instance_state();
+        return;
+    }
+
+    uint32_t created = instance_artboards.size();
+    if (created == count) return;
+    if (created < count && !is_inside_tree()) return;
+
+    instance_artboards.resize(count);
+    instance_state_machines.resize(count);
+    instance_animations.resize(count);
+    instance_artboard_memory.resize(count);
+    instance_state_machine_memory.resize(count);
+    for (uint32_t i = created; i < count; i++) {
+        _create_instance_state(i);
+    }
+}
+
+void RiveMultiInstance::_clear_instance_state() {
+    // State machines and animations reference their artboards, release them first.
+    instance_state_machines.clear();
+    instance_animations.clear();
+    instance_artboards.clear();
+    instance_artboard_memory.clear();
+    instance_state_machine_memory.clear();
+}
+
+void RiveMultiInstance::set_per_instance_state(bool p_enabled) {
+    if (per_instance_state == p_enabled) return;
+    per_instance_state = p_enabled;
+    animating = true;
+    _sync_instance_state();
+    _instance_time_changed();
+    queue_redraw();
+}
+
+bool RiveMultiInstance::get_per_instance_state() const {
+    return per_instance_state;
+}
+
+void RiveMultiInstance::set_instance_speed(int p_index, float p_speed) {
+    ERR_FAIL_INDEX(p_index, (int)instance_speeds.size());
+    instance_speeds[p_index] = p_speed;
+    _instance_time_changed();
+}
+
+float RiveMultiInstance::get_instance_speed(int p_index) const {
+    ERR_FAIL_INDEX_V(p_index, (int)instance_speeds.size(), 1.0f);
+    return instance_speeds[p_index];
+}
+
+// Values past the instance count are ignored, instances past the array keep their speed.
+void RiveMultiInstance::set_instance_speeds(const PackedFloat32Array &p_speeds) {
+    uint32_t count = MIN((uint32_t)p_speeds.size(), instance_speeds.size());
+    if (count > 0) {
+        memcpy(instance_speeds.ptr(), p_speeds.ptr(), count * sizeof(float));
+    }
+    _instance_time_changed();
+}
+
+PackedFloat32Array RiveMultiInstance::get_instance_speeds() const {
+    PackedFloat32Array speeds;
+    speeds.resize(instance_speeds.size());
+    if (instance_speeds.size() > 0) {
+        memcpy(speeds.ptrw(), instance_speeds.ptr(), instance_speeds.size() * sizeof(float));
+    }
+    return speeds;
+}
+
+// Restarts the instance's playback and fast-forwards it by p_offset seconds.
+void RiveMultiInstance::set_instance_time_offset(int p_index, float p_offset) {
+    ERR_FAIL_INDEX(p_index, (int)instance_time_offsets.size());
+    instance_time_offsets[p_index] = MAX(p_offset, 0.0f);
+    if ((uint32_t)p_index < instance_artboards.size()) {
+        if (is_inside_tree()) {
+            _create_instance_state(p_index);
+            animating = true;
+        } else {
+            // Rebuilt with the final offsets on entering the tree.
+            _clear_instance_state();
+        }
+    }
+    _instance_time_changed();
+}
+
+float RiveMultiInstance::get_instance_time_offset(int p_index) const {
+    ERR_FAIL_INDEX_V(p_index, (int)instance_time_offsets.size(), 0.0f);
+    return instance_time_offsets[p_index];
+}
+
+void RiveMultiInstance::set_instance_time_offsets(const PackedFloat32Array &p_offsets) {
+    uint32_t count = MIN((uint32_t)p_offsets.size(), instance_time_offsets.size());
+    const float *src = p_offsets.ptr();
+    if (!is_inside_tree()) {
+        _clear_instance_state();
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        instance_time_offsets[i] = MAX(src[i], 0.0f);
+        if (i < instance_artboards.size()) {
+            _create_instance_state(i);
+        }
+    }
+    animating = true;
+    _instance_time_changed();
+}
+
+// True when some instance plays at its own speed or offset.
+bool RiveMultiInstance::_has_instance_time() const {
+    for (uint32_t i = 0; i < instance_speeds.size(); i++) {
+        if (instance_speeds[i] != 1.0f || instance_time_offsets[i] != 0.0f) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// A shared linear animation is posed per instance at draw time. A shared state machine
+// can't be, its instances need per_instance_state.
+void RiveMultiInstance::_instance_time_changed() {
+    if (per_instance_state) return;
+    if (state_machine && _has_instance_time()) {
+        WARN_PRINT_ONCE("RiveMultiInstance: instance_speeds and instance_time_offsets need per_instance_state with a state machine.");
+    }
+    animating = true;
+    queue_redraw();
+}
+
+// Poses the shared artboard at p_time seconds of the shared animation, wrapped like its loop mode.
+void RiveMultiInstance::_pose_shared_animation(float p_time) {
+    const rive::LinearAnimation *linear = animation->animation();
+    float start = linear->startSeconds();
+    float length = linear->endSeconds() - start;
+    float local = 0.0f;
+    if (length > 0.0f) {
+        switch ((rive::Loop)animation->loopValue()) {
+            case rive::Loop::loop:
+                local = Math::fposmod(p_time, length);
+                break;
+            case rive::Loop::pingPong:
+                local = Math::fposmod(p_time, length * 2.0f);
+                if (local > length) {
+                    local = length * 2.0f - local;
+                }
+                break;
+            default:
+                local = CLAMP(p_time, 0.0f, length);
+                break;
+        }
+    }
+    animation->time(start + local);
+    animation->apply();
+    artboard->advance(0.0f);
+}
+
+PackedFloat32Array RiveMultiInstance::get_instance_time_offsets() const {
+    PackedFloat32Array offsets;
+    offsets.resize(instance_time_offsets.size());
+    if (instance_time_offsets.size() > 0) {
+        memcpy(offsets.ptrw(), instance_time_offsets.ptr(), instance_time_offsets.size() * sizeof(float));
+    }
+    return offsets;
+}
+
+// Runs on a worker thread, one call advances up to INSTANCE_BATCH_SIZE consecutive instances.
+// Instances only share the immutable rive::File, so batches never touch the same state.
+void RiveMultiInstance::_advance_instance_batch(void *p_userdata, uint32_t p_batch) {
+    RiveMultiInstance *self = static_cast<RiveMultiInstance *>(p_userdata);
+    RIVE_PROFILE_ZONE("RiveMultiInstance::advance_instances");
+
+    uint32_t begin = p_batch * INSTANCE_BATCH_SIZE;
+    uint32_t end = MIN(begin + INSTANCE_BATCH_SIZE, (uint32_t)self->instance_artboards.size());
+    for (uint32_t i = begin; i < end; i++) {
+        rive::ArtboardInstance *instance_artboard = self->instance_artboards[i].get();
+        if (!instance_artboard) continue;
+
+        float delta = self->current_delta * self->instance_speeds[i];
+        bool keep_going = false;
+        if (self->instance_state_machines[i]) {
+            keep_going = self->instance_state_machines[i]->advance(delta);
+        } else if (self->instance_animations[i]) {
+            keep_going = self->instance_animations[i]->advance(delta);
+            self->instance_animations[i]->apply();
+        }
+        bool updated = instance_artboard->advance(delta);
+        self->instance_animating[i] = (keep_going || updated) ? 1 : 0;
     }
 }
 
@@ -132,59 +589,461 @@ void RiveMultiInstance::advance(double delta) {
     if (!artboard) return;
     if (!auto_play) return;
 
+    if (!instance_artboards.empty()) {
+        uint32_t batch_count = (instance_artboards.size() + INSTANCE_BATCH_SIZE - 1) / INSTANCE_BATCH_SIZE;
+        current_delta = delta;
+        // RiveCanvas2D may already be advancing us on a worker. Waiting on a nested group
+        // there can starve the pool, so only fan out from the main thread.
+        OS *os = OS::get_singleton();
+        if (batch_count == 1 || os->get_thread_caller_id() != os->get_main_thread_id()) {
+            for (uint32_t i = 0; i < batch_count; i++) {
+                _advance_instance_batch(this, i);
+            }
+        } else {
+            WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+            int64_t group_id = pool->add_native_group_task(&RiveMultiInstance::_advance_instance_batch, this, batch_count, -1, true, "RiveMultiInstance Advance");
+            pool->wait_for_group_task_completion(group_id);
+        }
+
+        animating = false;
+        for (uint32_t i = 0; i < instance_animating.size(); i++) {
+            if (instance_animating[i]) {
+                animating = true;
+                break;
+            }
+        }
+        return;
+    }
+
+    bool keep_going = false;
     if (state_machine) {
-        state_machine->advance(delta);
+        keep_going = state_machine->advance(delta);
     } else if (animation) {
-        animation->advance(delta);
+        keep_going = animation->advance(delta);
         animation->apply();
+        shared_time += delta;
     }
     
-    artboard->advance(delta);
+    bool updated = artboard->advance(delta);
+    animating = keep_going || updated;
+
+    // A one-shot shared animation can end before slower instances posed from it do.
+    if (!animating && animation && !per_instance_state && _has_instance_time()) {
+        const rive::LinearAnimation *linear = animation->animation();
+        double length = linear->endSeconds() - linear->startSeconds();
+        for (uint32_t i = 0; i < instance_speeds.size(); i++) {
+            if (instance_time_offsets[i] + shared_time * instance_speeds[i] < length) {
+                animating = true;
+                break;
+            }
+        }
+    }
 }
 
 void RiveMultiInstance::draw(rive::Renderer *renderer) {
+    _draw_instances(renderer, nullptr);
+}
+
+void RiveMultiInstance::draw_culled(rive::Renderer *renderer, const Rect2 &p_cull_rect) {
+    _draw_instances(renderer, &p_cull_rect);
+}
+
+void RiveMultiInstance::_draw_instances(rive::Renderer *renderer, const Rect2 *p_cull_rect) {
     if (!artboard) return;
     
     Transform2D base_xform = get_transform();
+    rive::Mat2D base_transform(
+        base_xform.columns[0].x, base_xform.columns[0].y,
+        base_xform.columns[1].x, base_xform.columns[1].y,
+        base_xform.columns[2].x, base_xform.columns[2].y
+    );
+
+    // Cull in the node's space, against the bounding box of the rect mapped back into it.
+    Rect2 cull_rect;
+    if (p_cull_rect) {
+        _update_instance_bounds();
+        cull_rect = base_xform.affine_inverse().xform(*p_cull_rect);
+        if (!cull_rect.intersects(merged_bounds)) return;
+    }
+    float cull_min_x = cull_rect.position.x;
+    float cull_min_y = cull_rect.position.y;
+    float cull_max_x = cull_rect.get_end().x;
+    float cull_max_y = cull_rect.get_end().y;
     
-    for (int i = 0; i < transforms.size(); i++) {
-        Transform2D t = transforms[i];
-        Transform2D final_xform = base_xform * t;
-        
+    uint32_t count = get_instance_count();
+    bool per_instance = instance_artboards.size() == count;
+    bool impostors = _impostors_active();
+    float screen_scale = impostors ? _impostor_screen_scale() : 1.0f;
+    // Without per-instance artboards, speeds and offsets re-pose the shared animation per instance.
+    bool instance_time = !per_instance && !state_machine && animation && _has_instance_time();
+    float shared_pose = instance_time ? animation->time() : 0.0f;
+    for (uint32_t i = 0; i < count; i++) {
+        if (p_cull_rect && (bounds_max_x[i] < cull_min_x || bounds_min_x[i] > cull_max_x || bounds_max_y[i] < cull_min_y || bounds_min_y[i] > cull_max_y)) {
+            continue;
+        }
+        if (impostors && _is_impostor(i, screen_scale)) {
+            continue;
+        }
+
+        rive::ArtboardInstance *instance_artboard = per_instance ? instance_artboards[i].get() : artboard.get();
+        if (!instance_artboard) continue;
+        if (instance_time) {
+            _pose_shared_animation((float)(instance_time_offsets[i] + shared_time * instance_speeds[i]));
+        }
+
         renderer->save();
-        
-        rive::Mat2D rive_transform(
-            final_xform.columns[0].x, final_xform.columns[0].y,
-            final_xform.columns[1].x, final_xform.columns[1].y,
-            final_xform.columns[2].x, final_xform.columns[2].y
-        );
-        
-        renderer->transform(rive_transform);
-        artboard->draw(renderer);
-        
+        renderer->transform(base_transform * _get_instance_mat(i));
+        instance_artboard->draw(renderer);
         renderer->restore();
     }
+
+    if (instance_time) {
+        animation->time(shared_pose);
+        animation->apply();
+        artboard->advance(0.0f);
+    }
 }
 
-Rect2 RiveMultiInstance::get_rive_bounds() const {
-    if (artboard && transforms.size() > 0) {
-        rive::AABB aabb = artboard->bounds();
-        Rect2 base_rect(aabb.minX, aabb.minY, aabb.width(), aabb.height());
-        
-        Rect2 total_rect;
-        bool first = true;
-        
-        for (int i = 0; i < transforms.size(); i++) {
-            Transform2D t = transforms[i];
-            Rect2 r = t.xform(base_rect);
-            if (first) {
-                total_rect = r;
-                first = false;
-            } else {
-                total_rect = total_rect.merge(r);
-            }
+void RiveMultiInstance::set_impostor_mode(bool p_enabled) {
+    if (impostor_mode == p_enabled) return;
+    impostor_mode = p_enabled;
+    set_process(impostor_mode);
+    if (!impostor_mode) {
+        _clear_impostors();
+    }
+    queue_redraw();
+}
+
+bool RiveMultiInstance::get_impostor_mode() const {
+    return impostor_mode;
+}
+
+void RiveMultiInstance::set_impostor_max_size(float p_size) {
+    impostor_max_size = MAX(p_size, 1.0f);
+}
+
+float RiveMultiInstance::get_impostor_max_size() const {
+    return impostor_max_size;
+}
+
+// Impostors need every instance to show the same frame, so not with per-instance playback.
+bool RiveMultiInstance::_impostors_active() const {
+    return impostor_mode && !per_instance_state && artboard && is_inside_tree() && (state_machine || !_has_instance_time());
+}
+
+// Node space -> screen pixels, the larger axis.
+float RiveMultiInstance::_impostor_screen_scale() const {
+    Transform2D screen = get_viewport()->get_final_transform() * get_global_transform_with_canvas();
+    return MAX(screen.columns[0].length(), screen.columns[1].length());
+}
+
+// Rotated or skewed instances can't be a quad of an axis-aligned raster, large ones would need
+// a texture too big to be worth it. Both fall back to vector drawing.
+bool RiveMultiInstance::_is_impostor(uint32_t p_index, float p_screen_scale) const {
+    const float *m = instance_data.ptr() + p_index * FLOATS_PER_INSTANCE;
+    float sx = Math::abs(m[0]);
+    float sy = Math::abs(m[3]);
+    if (Math::abs(m[1]) > (sx + sy) * 1e-4f || Math::abs(m[2]) > (sx + sy) * 1e-4f) {
+        return false;
+    }
+
+    rive::AABB aabb = artboard->bounds();
+    return MAX(sx * aabb.width(), sy * aabb.height()) * p_screen_scale <= impostor_max_size;
+}
+
+void RiveMultiInstance::ImpostorDrawable::draw(rive::Renderer *renderer) {
+    rive::AABB aabb = owner->artboard->bounds();
+    renderer->transform(rive::Mat2D(scale, 0.0f, 0.0f, scale, -aabb.minX * scale, -aabb.minY * scale));
+    owner->artboard->draw(renderer);
+}
+
+void RiveMultiInstance::_draw_impostors() {
+    if (!_impostors_active()) return;
+    RIVE_PROFILE_ZONE("RiveMultiInstance::draw_impostors");
+
+    float screen_scale = _impostor_screen_scale();
+    rive::AABB aabb = artboard->bounds();
+    uint32_t count = get_instance_count();
+
+    // set_buffer() wants exactly instance_count * 8 floats, also after the count shrank.
+    if (impostor_buffer.size() != (int64_t)count * MULTIMESH_FLOATS_PER_INSTANCE) {
+        impostor_buffer.resize(count * MULTIMESH_FLOATS_PER_INSTANCE);
+    }
+
+    // Pick the impostors and the largest on-screen scale among them.
+    float *dst = impostor_buffer.ptrw();
+    uint32_t visible = 0;
+    float max_scale = 0.0f;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!_is_impostor(i, screen_scale)) continue;
+
+        // Unit quad -> artboard rect in the instance's space.
+        const float *m = instance_data.ptr() + i * FLOATS_PER_INSTANCE;
+        float *d = dst + visible * MULTIMESH_FLOATS_PER_INSTANCE;
+        d[0] = m[0] * aabb.width();
+        d[1] = 0.0f;
+        d[2] = 0.0f;
+        d[3] = m[4] + m[0] * aabb.minX;
+        d[4] = 0.0f;
+        d[5] = m[3] * aabb.height();
+        d[6] = 0.0f;
+        d[7] = m[5] + m[3] * aabb.minY;
+        max_scale = MAX(max_scale, MAX(Math::abs(m[0]), Math::abs(m[3])));
+        visible++;
+    }
+    if (visible == 0) return;
+
+    // Power of two tiers, so zooming doesn't reallocate the texture every frame.
+    float wanted = max_scale * screen_scale;
+    float tier = 1.0f / 64.0f;
+    while (tier < wanted) {
+        tier *= 2.0f;
+    }
+    Vector2i pixels(CLAMP((int)Math::ceil(aabb.width() * tier), 1, MAX_IMPOSTOR_PIXELS), CLAMP((int)Math::ceil(aabb.height() * tier), 1, MAX_IMPOSTOR_PIXELS));
+    tier = MIN(tier, MIN(pixels.x / MAX(aabb.width(), 1.0f), pixels.y / MAX(aabb.height(), 1.0f)));
+
+    RenderingServer *rs = RenderingServer::get_singleton();
+    if (!rs) return;
+
+    if (impostor_target.is_null()) {
+        impostor_target.instantiate();
+    }
+    if (impostor_target->resize(pixels) || tier != impostor_scale) {
+        impostor_valid = false;
+    }
+    if (!impostor_valid || animating) {
+        impostor_scale = tier;
+        impostor_drawable.scale = tier;
+        rive_integration::render_texture(rs->get_rendering_device(), impostor_target->get_texture_rid(), &impostor_drawable, pixels.x, pixels.y);
+        impostor_valid = true;
+    }
+
+    if (impostor_multimesh.is_null()) {
+        PackedVector2Array vertices;
+        vertices.push_back(Vector2(0, 0));
+        vertices.push_back(Vector2(1, 0));
+        vertices.push_back(Vector2(1, 1));
+        vertices.push_back(Vector2(0, 1));
+        PackedInt32Array indices;
+        indices.push_back(0);
+        indices.push_back(1);
+        indices.push_back(2);
+        indices.push_back(0);
+        indices.push_back(2);
+        indices.push_back(3);
+        Array arrays;
+        arrays.resize(Mesh::ARRAY_MAX);
+        arrays[Mesh::ARRAY_VERTEX] = vertices;
+        arrays[Mesh::ARRAY_TEX_UV] = vertices;
+        arrays[Mesh::ARRAY_INDEX] = indices;
+        Ref<ArrayMesh> quad;
+        quad.instantiate();
+        quad->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+
+        impostor_multimesh.instantiate();
+        impostor_multimesh->set_transform_format(MultiMesh::TRANSFORM_2D);
+        impostor_multimesh->set_mesh(quad);
+    }
+    if (impostor_multimesh->get_instance_count() != (int32_t)count) {
+        impostor_multimesh->set_instance_count(count);
+    }
+    impostor_multimesh->set_buffer(impostor_buffer);
+    impostor_multimesh->set_visible_instance_count(visible);
+
+    if (impostor_target->get_texture_rd().is_valid()) {
+        draw_multimesh(impostor_multimesh, impostor_target->get_texture_rd());
+    } else if (impostor_target->get_texture_rid().is_valid()) {
+        rs->canvas_item_add_multimesh(get_canvas_item(), impostor_multimesh->get_rid(), impostor_target->get_texture_rid());
+    }
+}
+
+void RiveMultiInstance::_clear_impostors() {
+    impostor_target.unref();
+    impostor_multimesh.unref();
+    impostor_buffer.clear();
+    impostor_scale = 0.0f;
+    impostor_valid = false;
+}
+
+// Instance i follows p_nodes[i]. Replaces the transforms and any bodies set before.
+void RiveMultiInstance::set_source_nodes(const Array &p_nodes) {
+    source_bodies.clear();
+    source_nodes.resize(p_nodes.size());
+    for (int i = 0; i < p_nodes.size(); i++) {
+        Node2D *node = Object::cast_to<Node2D>(p_nodes[i]);
+        source_nodes[i] = node ? ObjectID(node->get_instance_id()) : ObjectID();
+    }
+    set_instance_count(source_nodes.size());
+    set_process_internal(!source_nodes.is_empty());
+    _sync_sources();
+}
+
+Array RiveMultiInstance::get_source_nodes() const {
+    Array nodes;
+    for (const ObjectID &id : source_nodes) {
+        nodes.push_back(ObjectDB::get_instance(id));
+    }
+    return nodes;
+}
+
+// Instance i follows the PhysicsServer2D body p_bodies[i]. Replaces the transforms and any nodes set before.
+void RiveMultiInstance::set_source_bodies(const Array &p_bodies) {
+    source_nodes.clear();
+    source_bodies.resize(p_bodies.size());
+    for (int i = 0; i < p_bodies.size(); i++) {
+        source_bodies[i] = p_bodies[i];
+    }
+    set_instance_count(source_bodies.size());
+    set_process_internal(!source_bodies.is_empty());
+    _sync_sources();
+}
+
+Array RiveMultiInstance::get_source_bodies() const {
+    Array bodies;
+    for (const RID &rid : source_bodies) {
+        bodies.push_back(rid);
+    }
+    return bodies;
+}
+
+// Stops following, the instances keep their last transforms.
+void RiveMultiInstance::clear_sources() {
+    source_nodes.clear();
+    source_bodies.clear();
+    set_process_internal(false);
+}
+
+// Pulls every source's global transform into the instance buffer, relative to this node.
+// Sources that are gone leave their instance where it was.
+void RiveMultiInstance::_sync_sources() {
+    if (!is_inside_tree()) return;
+    if (source_nodes.is_empty() && source_bodies.is_empty()) return;
+    RIVE_PROFILE_ZONE("RiveMultiInstance::sync_sources");
+
+    Transform2D to_local = get_global_transform().affine_inverse();
+    uint32_t count = MIN((uint32_t)get_instance_count(), MAX(source_nodes.size(), source_bodies.size()));
+    PhysicsServer2D *physics = source_bodies.is_empty() ? nullptr : PhysicsServer2D::get_singleton();
+
+    bool changed = false;
+    for (uint32_t i = 0; i < count; i++) {
+        Transform2D global;
+        if (physics) {
+            // Unlike body_get_direct_state(), also valid outside the physics step with threaded physics.
+            Variant state = physics->body_get_state(source_bodies[i], PhysicsServer2D::BODY_STATE_TRANSFORM);
+            if (state.get_type() != Variant::TRANSFORM2D) continue;
+            global = state;
+        } else {
+            Node2D *node = Object::cast_to<Node2D>(ObjectDB::get_instance(source_nodes[i]));
+            if (!node) continue;
+            global = node->get_global_transform();
+        }
+
+        Transform2D t = to_local * global;
+        const float values[FLOATS_PER_INSTANCE] = {
+            (float)t.columns[0].x, (float)t.columns[0].y,
+            (float)t.columns[1].x, (float)t.columns[1].y,
+            (float)t.columns[2].x, (float)t.columns[2].y,
+        };
+        float *d = instance_data.ptr() + i * FLOATS_PER_INSTANCE;
+        if (memcmp(d, values, sizeof(values)) != 0) {
+            memcpy(d, values, sizeof(values));
+            changed = true;
         }
-        return total_rect;
     }
-    return Rect2();
+    // Resting sources must not rebuild the bounds, re-render tiles or bypass max_render_fps.
+    if (changed) {
+        _transforms_changed();
+    }
+}
+
+// The box of a transformed rect is origin + per axis sums of min/max(column * corner):
+// min_x = tx + min(a * x0, a * x1) + min(c * y0, c * y1), and likewise for the others.
+void RiveMultiInstance::_update_instance_bounds() const {
+    if (!instance_bounds_dirty) return;
+    instance_bounds_dirty = false;
+
+    uint32_t count = get_instance_count();
+    bounds_min_x.resize(count);
+    bounds_min_y.resize(count);
+    bounds_max_x.resize(count);
+    bounds_max_y.resize(count);
+    merged_bounds = Rect2();
+    if (!artboard || count == 0) return;
+
+    rive::AABB aabb = artboard->bounds();
+    const float x0 = aabb.minX, y0 = aabb.minY, x1 = aabb.maxX, y1 = aabb.maxY;
+    const float *d = instance_data.ptr();
+    float merged_min_x = FLT_MAX, merged_min_y = FLT_MAX, merged_max_x = -FLT_MAX, merged_max_y = -FLT_MAX;
+    uint32_t i = 0;
+
+#ifdef RIVE_MULTI_INSTANCE_SSE2
+    const __m128 vx0 = _mm_set1_ps(x0), vy0 = _mm_set1_ps(y0), vx1 = _mm_set1_ps(x1), vy1 = _mm_set1_ps(y1);
+    __m128 vmerged_min_x = _mm_set1_ps(FLT_MAX), vmerged_min_y = _mm_set1_ps(FLT_MAX);
+    __m128 vmerged_max_x = _mm_set1_ps(-FLT_MAX), vmerged_max_y = _mm_set1_ps(-FLT_MAX);
+    for (; i + 4 <= count; i += 4) {
+        const float *m = d + i * FLOATS_PER_INSTANCE;
+        // Gather four interleaved transforms into one lane each.
+        __m128 a = _mm_setr_ps(m[0], m[6], m[12], m[18]);
+        __m128 b = _mm_setr_ps(m[1], m[7], m[13], m[19]);
+        __m128 c = _mm_setr_ps(m[2], m[8], m[14], m[20]);
+        __m128 dd = _mm_setr_ps(m[3], m[9], m[15], m[21]);
+        __m128 tx = _mm_setr_ps(m[4], m[10], m[16], m[22]);
+        __m128 ty = _mm_setr_ps(m[5], m[11], m[17], m[23]);
+
+        __m128 ax0 = _mm_mul_ps(a, vx0), ax1 = _mm_mul_ps(a, vx1);
+        __m128 cy0 = _mm_mul_ps(c, vy0), cy1 = _mm_mul_ps(c, vy1);
+        __m128 bx0 = _mm_mul_ps(b, vx0), bx1 = _mm_mul_ps(b, vx1);
+        __m128 dy0 = _mm_mul_ps(dd, vy0), dy1 = _mm_mul_ps(dd, vy1);
+
+        __m128 min_x = _mm_add_ps(tx, _mm_add_ps(_mm_min_ps(ax0, ax1), _mm_min_ps(cy0, cy1)));
+        __m128 max_x = _mm_add_ps(tx, _mm_add_ps(_mm_max_ps(ax0, ax1), _mm_max_ps(cy0, cy1)));
+        __m128 min_y = _mm_add_ps(ty, _mm_add_ps(_mm_min_ps(bx0, bx1), _mm_min_ps(dy0, dy1)));
+        __m128 max_y = _mm_add_ps(ty, _mm_add_ps(_mm_max_ps(bx0, bx1), _mm_max_ps(dy0, dy1)));
+
+        _mm_storeu_ps(bounds_min_x.ptr() + i, min_x);
+        _mm_storeu_ps(bounds_max_x.ptr() + i, max_x);
+        _mm_storeu_ps(bounds_min_y.ptr() + i, min_y);
+        _mm_storeu_ps(bounds_max_y.ptr() + i, max_y);
+
+        vmerged_min_x = _mm_min_ps(vmerged_min_x, min_x);
+        vmerged_max_x = _mm_max_ps(vmerged_max_x, max_x);
+        vmerged_min_y = _mm_min_ps(vmerged_min_y, min_y);
+        vmerged_max_y = _mm_max_ps(vmerged_max_y, max_y);
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, vmerged_min_x);
+    merged_min_x = MIN(MIN(lanes[0], lanes[1]), MIN(lanes[2], lanes[3]));
+    _mm_storeu_ps(lanes, vmerged_min_y);
+    merged_min_y = MIN(MIN(lanes[0], lanes[1]), MIN(lanes[2], lanes[3]));
+    _mm_storeu_ps(lanes, vmerged_max_x);
+    merged_max_x = MAX(MAX(lanes[0], lanes[1]), MAX(lanes[2], lanes[3]));
+    _mm_storeu_ps(lanes, vmerged_max_y);
+    merged_max_y = MAX(MAX(lanes[0], lanes[1]), MAX(lanes[2], lanes[3]));
+#endif
+
+    for (; i < count; i++) {
+        const float *m = d + i * FLOATS_PER_INSTANCE;
+        float ax0 = m[0] * x0, ax1 = m[0] * x1;
+        float bx0 = m[1] * x0, bx1 = m[1] * x1;
+        float cy0 = m[2] * y0, cy1 = m[2] * y1;
+        float dy0 = m[3] * y0, dy1 = m[3] * y1;
+
+        bounds_min_x[i] = m[4] + MIN(ax0, ax1) + MIN(cy0, cy1);
+        bounds_max_x[i] = m[4] + MAX(ax0, ax1) + MAX(cy0, cy1);
+        bounds_min_y[i] = m[5] + MIN(bx0, bx1) + MIN(dy0, dy1);
+        bounds_max_y[i] = m[5] + MAX(bx0, bx1) + MAX(dy0, dy1);
+
+        merged_min_x = MIN(merged_min_x, bounds_min_x[i]);
+        merged_max_x = MAX(merged_max_x, bounds_max_x[i]);
+        merged_min_y = MIN(merged_min_y, bounds_min_y[i]);
+        merged_max_y = MAX(merged_max_y, bounds_max_y[i]);
+    }
+
+    merged_bounds = Rect2(merged_min_x, merged_min_y, merged_max_x - merged_min_x, merged_max_y - merged_min_y);
+}
+
+Rect2 RiveMultiInstance::get_rive_bounds() const {
+    _update_instance_bounds();
+    return merged_bounds;
 }
@@ -2,10 +2,15 @@
 #define RIVE_MULTI_INSTANCE_H
 
 #include "rive_node.h"
+#include <godot_cpp/templates/local_vector.hpp>
 #include "../resources/rive_file.h"
+#include "../renderer/rive_render_registry.h"
+#include "../renderer/rive_texture_target.h"
+#include <godot_cpp/classes/multi_mesh.hpp>
 #include <rive/artboard.hpp>
 #include <rive/animation/state_machine_instance.hpp>
 #include <rive/animation/linear_animation_instance.hpp>
+#include <vector>
 
 using namespace godot;
 
@@ -22,23 +27,93 @@ private:
     String state_machine_name;
     String animation_name;
     bool auto_play = true;
+    bool animating = true;
+    // Setters only store the configuration outside the tree, the artboard is built on entering it.
+    bool artboard_dirty = true;
 
-    PackedVector2Array positions;
-    PackedFloat32Array scales;
-    PackedFloat32Array rotations;
-    // Or just a list of Transforms, but Godot usually exposes Arrays.
-    // For simplicity, let's use a PackedVector2Array for positions first, 
-    // maybe later full transforms.
-    // Let's use Transform2D array for maximum flexibility.
-    Array transforms; 
+    // Instance transforms relative to the node, FLOATS_PER_INSTANCE floats each in rive::Mat2D
+    // order (x axis, y axis, origin), so they can be bulk copied from a PackedFloat32Array.
+    LocalVector<float> instance_data;
+
+    RiveMemoryHandle artboard_memory;
+    RiveMemoryHandle state_machine_memory;
+
+    // Per-instance playback, structure of arrays indexed like the transforms. Speeds and
+    // offsets are always sized to the instance count. With per_instance_state every instance
+    // also owns an artboard and state machine (or animation) over the shared rive::File.
+    // Those are only built inside the tree, so a loading scene creates each one once.
+    bool per_instance_state = false;
+    LocalVector<float> instance_speeds;
+    LocalVector<float> instance_time_offsets;
+    LocalVector<uint8_t> instance_animating;
+    std::vector<std::unique_ptr<rive::ArtboardInstance>> instance_artboards;
+    std::vector<std::unique_ptr<rive::StateMachineInstance>> instance_state_machines;
+    std::vector<std::unique_ptr<rive::LinearAnimationInstance>> instance_animations;
+    std::vector<RiveMemoryHandle> instance_artboard_memory;
+    std::vector<RiveMemoryHandle> instance_state_machine_memory;
+    double current_delta = 0.0;
+    // Time the shared animation has played, unwrapped, to pose it per instance at draw time.
+    double shared_time = 0.0;
+
+    // Per-instance AABBs in the node's space (structure of arrays) and their union. Rebuilt
+    // lazily after transforms or the artboard change.
+    mutable LocalVector<float> bounds_min_x;
+    mutable LocalVector<float> bounds_min_y;
+    mutable LocalVector<float> bounds_max_x;
+    mutable LocalVector<float> bounds_max_y;
+    mutable Rect2 merged_bounds;
+    mutable bool instance_bounds_dirty = true;
+
+    // Impostor mode: small, axis-aligned instances are drawn as quads of one rasterized frame
+    // through a MultiMesh on this node's own canvas item, the rest still go through draw().
+    struct ImpostorDrawable : public RiveDrawable {
+        RiveMultiInstance *owner = nullptr;
+        float scale = 1.0f;
+        void draw(rive::Renderer *renderer) override;
+    };
+
+    bool impostor_mode = false;
+    float impostor_max_size = 128.0f;
+    Ref<RiveTextureTarget> impostor_target;
+    Ref<MultiMesh> impostor_multimesh;
+    ImpostorDrawable impostor_drawable;
+    PackedFloat32Array impostor_buffer;
+    float impostor_scale = 0.0f;
+    bool impostor_valid = false;
+
+    // Transform sources pulled every frame, one per instance. Either Node2Ds (by ObjectID, so
+    // freed nodes are skipped) or PhysicsServer2D bodies, never both.
+    LocalVector<ObjectID> source_nodes;
+    LocalVector<RID> source_bodies;
+
+    static void _advance_instance_batch(void *p_userdata, uint32_t p_batch);
 
     void _load_artboard();
+    void _create_playback(rive::ArtboardInstance *p_artboard, std::unique_ptr<rive::StateMachineInstance> &r_state_machine, std::unique_ptr<rive::LinearAnimationInstance> &r_animation) const;
+    void _create_instance_state(uint32_t p_index);
+    void _sync_instance_state();
+    void _clear_instance_state();
+    bool _has_instance_time() const;
+    void _instance_time_changed();
+    void _pose_shared_animation(float p_time);
+    void _transforms_changed();
+    rive::Mat2D _get_instance_mat(uint32_t p_index) const;
+    void _update_instance_bounds() const;
+    void _draw_instances(rive::Renderer *renderer, const Rect2 *p_cull_rect);
+    bool _impostors_active() const;
+    float _impostor_screen_scale() const;
+    bool _is_impostor(uint32_t p_index, float p_screen_scale) const;
+    void _draw_impostors();
+    void _clear_impostors();
+    void _sync_sources();
 
 protected:
     static void _bind_methods();
     void _notification(int p_what);
 
 public:
+    static const int FLOATS_PER_INSTANCE = 6;
+
     RiveMultiInstance();
     ~RiveMultiInstance();
 
@@ -60,9 +135,42 @@ public:
     void set_transforms(const Array &p_transforms);
     Array get_transforms() const;
 
+    void set_instance_count(int p_count);
+    int get_instance_count() const;
+    void set_instance_transforms(const PackedFloat32Array &p_data);
+    PackedFloat32Array get_instance_transforms() const;
+    void set_instance_positions(const PackedVector2Array &p_positions);
+    void set_instance_transform(int p_index, const Transform2D &p_transform);
+    Transform2D get_instance_transform(int p_index) const;
+    void set_instance_position(int p_index, const Vector2 &p_position);
+
+    void set_per_instance_state(bool p_enabled);
+    bool get_per_instance_state() const;
+    void set_instance_speed(int p_index, float p_speed);
+    float get_instance_speed(int p_index) const;
+    void set_instance_speeds(const PackedFloat32Array &p_speeds);
+    PackedFloat32Array get_instance_speeds() const;
+    void set_instance_time_offset(int p_index, float p_offset);
+    float get_instance_time_offset(int p_index) const;
+    void set_instance_time_offsets(const PackedFloat32Array &p_offsets);
+    PackedFloat32Array get_instance_time_offsets() const;
+
+    void set_impostor_mode(bool p_enabled);
+    bool get_impostor_mode() const;
+    void set_impostor_max_size(float p_size);
+    float get_impostor_max_size() const;
+
+    void set_source_nodes(const Array &p_nodes);
+    Array get_source_nodes() const;
+    void set_source_bodies(const Array &p_bodies);
+    Array get_source_bodies() const;
+    void clear_sources();
+
     void advance(double delta) override;
     void draw(rive::Renderer *renderer) override;
+    void draw_culled(rive::Renderer *renderer, const Rect2 &p_cull_rect) override;
     Rect2 get_rive_bounds() const override;
+    bool is_animating() const override { return animating; }
 };
 
 #endif
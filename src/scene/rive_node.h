@@ -6,19 +6,85 @@
 
 using namespace godot;
 
+class RiveNode;
+
+// Implemented by parents that index their RiveNode children (RiveCanvas2D).
+class RiveNodeContainer {
+public:
+    virtual ~RiveNodeContainer() {}
+    virtual void _rive_node_bounds_changed(RiveNode *p_node) = 0;
+};
+
 class RiveNode : public Node2D {
     GDCLASS(RiveNode, Node2D);
 
+private:
+    RiveNodeContainer *container = nullptr;
+    uint32_t container_slot = 0;
+    bool bounds_dirty = false;
+    // Time held back by the container's animation LOD while the node sits out frames.
+    double lod_delta = 0.0;
+    bool lod_skipped = false;
+
 protected:
     static void _bind_methods() {}
 
+    void _notification(int p_what) {
+        if (p_what == NOTIFICATION_LOCAL_TRANSFORM_CHANGED || p_what == NOTIFICATION_VISIBILITY_CHANGED) {
+            _rive_bounds_changed();
+        }
+    }
+
+    // Call when get_rive_bounds() changes, e.g. after loading another artboard.
+    void _rive_bounds_changed() {
+        if (container && !bounds_dirty) {
+            bounds_dirty = true;
+            container->_rive_node_bounds_changed(this);
+        }
+    }
+
 public:
+    RiveNode() {
+        set_notify_local_transform(true);
+    }
+
     virtual void draw(rive::Renderer* renderer) {}
+    // Called by containers instead of draw(). p_cull_rect is the part of the parent's space
+    // being rendered, nodes drawing many primitives can skip what falls outside it.
+    virtual void draw_culled(rive::Renderer* renderer, const Rect2 &p_cull_rect) { draw(renderer); }
     virtual void advance(double delta) {}
+    // In the node's local space. An empty rect means unbounded, the node is never culled.
     virtual Rect2 get_rive_bounds() const { return Rect2(); }
-    virtual void pointer_down(Vector2 position) {}
-    virtual void pointer_up(Vector2 position) {}
-    virtual void pointer_move(Vector2 position) {}
+    // Whether the last advance changed what draw() produces. Containers that cache
+    // rendered output re-render nodes reporting true; the default is conservative.
+    virtual bool is_animating() const { return true; }
+    // Whether input or a data write arrived that the next advance() will show and clear. Nodes
+    // that don't advance must report false. Containers running on a frame rate cap render at
+    // once for the nodes they advance reporting true.
+    virtual bool has_external_change() const { return false; }
+    // Positions are in the parent's space. Return true if the pointer hit something interactive.
+    virtual bool pointer_down(Vector2 position) { return false; }
+    virtual bool pointer_up(Vector2 position) { return false; }
+    virtual bool pointer_move(Vector2 position) { return false; }
+
+    // Bookkeeping for the owning container.
+    // A new container starts with the node dirty and indexes it on its next flush.
+    void set_container(RiveNodeContainer *p_container) {
+        container = p_container;
+        bounds_dirty = p_container != nullptr;
+        lod_delta = 0.0;
+        lod_skipped = false;
+    }
+    RiveNodeContainer *get_container() const { return container; }
+    void set_container_slot(uint32_t p_slot) { container_slot = p_slot; }
+    uint32_t get_container_slot() const { return container_slot; }
+    void clear_bounds_dirty() { bounds_dirty = false; }
+    bool is_bounds_dirty() const { return bounds_dirty; }
+    void add_lod_delta(double p_delta) { lod_delta += p_delta; }
+    double take_lod_delta() { double delta = lod_delta; lod_delta = 0.0; return delta; }
+    // True when the node was not advanced this frame, so its pose is the one already drawn.
+    void set_lod_skipped(bool p_skipped) { lod_skipped = p_skipped; }
+    bool is_lod_skipped() const { return lod_skipped; }
 };
 
 #endif
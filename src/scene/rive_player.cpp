@@ -1,19 +1,73 @@
 #include "rive_player.h"
 #include "../renderer/rive_render_registry.h"
+#include "../renderer/rive_renderer.h"
+#include "../renderer/rive_texture_target.h"
+#include "../resources/rive_file.h"
+#include "../rive_profiler.h"
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include "rive/layout.hpp"
+#include <rive/viewmodel/viewmodel_instance_number.hpp>
+#include <rive/viewmodel/viewmodel_instance_string.hpp>
+#include <rive/viewmodel/viewmodel_instance_boolean.hpp>
+#include <rive/viewmodel/viewmodel_instance_trigger.hpp>
+#include <rive/viewmodel/viewmodel_instance_viewmodel.hpp>
+#include <rive/viewmodel/viewmodel_instance_enum.hpp>
+#include <rive/viewmodel/viewmodel_instance_color.hpp>
 
 void RivePlayer::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_rive_view_model_instance"), &RivePlayer::get_rive_view_model_instance);
+
+    ClassDB::bind_method(D_METHOD("load_artboard", "file", "artboard_name"), &RivePlayer::load_artboard, DEFVAL(""));
+    ClassDB::bind_method(D_METHOD("advance", "delta"), &RivePlayer::advance);
+    ClassDB::bind_method(D_METHOD("advance_async", "delta"), &RivePlayer::advance_async);
+    ClassDB::bind_method(D_METHOD("finish_advance"), &RivePlayer::finish_advance);
+    ClassDB::bind_method(D_METHOD("is_animating"), &RivePlayer::is_animating);
+    ClassDB::bind_method(D_METHOD("play_animation", "name"), &RivePlayer::play_animation);
+    ClassDB::bind_method(D_METHOD("play_state_machine", "name"), &RivePlayer::play_state_machine);
+    ClassDB::bind_method(D_METHOD("get_animation_list"), &RivePlayer::get_animation_list);
+    ClassDB::bind_method(D_METHOD("get_state_machine_list"), &RivePlayer::get_state_machine_list);
+    ClassDB::bind_method(D_METHOD("get_animation_name"), &RivePlayer::get_animation_name);
+    ClassDB::bind_method(D_METHOD("get_state_machine_name"), &RivePlayer::get_state_machine_name);
+    ClassDB::bind_method(D_METHOD("render_to_image", "size"), &RivePlayer::render_to_image);
+
+    ClassDB::bind_method(D_METHOD("set_view_model_value", "property_path", "value"), &RivePlayer::set_view_model_value);
+    ClassDB::bind_method(D_METHOD("fire_view_model_trigger", "property_path"), &RivePlayer::fire_view_model_trigger);
+
+    ClassDB::bind_method(D_METHOD("start_recording"), &RivePlayer::start_recording);
+    ClassDB::bind_method(D_METHOD("stop_recording"), &RivePlayer::stop_recording);
+    ClassDB::bind_method(D_METHOD("is_recording"), &RivePlayer::is_recording);
+    ClassDB::bind_method(D_METHOD("start_replay", "recording"), &RivePlayer::start_replay);
+    ClassDB::bind_method(D_METHOD("replay_step"), &RivePlayer::replay_step);
+    ClassDB::bind_method(D_METHOD("replay", "recording"), &RivePlayer::replay);
+    ClassDB::bind_method(D_METHOD("is_replaying"), &RivePlayer::is_replaying);
 }
 
+namespace {
+
+class RivePlayerSnapshot : public RiveDrawable {
+public:
+    RivePlayer *player = nullptr;
+    rive::Mat2D transform;
+
+    void draw(rive::Renderer *renderer) override {
+        player->draw(renderer, transform);
+    }
+};
+
+} // namespace
+
 RivePlayer::RivePlayer() {
 }
 
 RivePlayer::~RivePlayer() {
+    finish_advance();
 }
 
 bool RivePlayer::load_from_bytes(const PackedByteArray &data) {
+    finish_advance();
     rive::Factory *factory = RiveRenderRegistry::get_singleton()->get_factory();
     if (!factory) {
         ERR_PRINT("Rive factory not available (context not created?)");
@@ -22,9 +76,14 @@ bool RivePlayer::load_from_bytes(const PackedByteArray &data) {
 
     rive::Span<const uint8_t> bytes(data.ptr(), data.size());
     rive::ImportResult result;
-    rive::rcp<rive::File> file = rive::File::import(bytes, factory, &result);
+    std::vector<RiveMemoryHandle> file_asset_memory;
+    rive::rcp<rive::File> file = rive_memory::import_file(bytes, factory, &result, memory_stats, file_asset_memory);
     
-    return load(file);
+    if (!load(file)) {
+        return false;
+    }
+    asset_memory = std::move(file_asset_memory);
+    return true;
 }
 
 bool RivePlayer::load(rive::rcp<rive::File> file) {
@@ -38,84 +97,142 @@ bool RivePlayer::load(rive::rcp<rive::File> file) {
     return false;
 }
 
+bool RivePlayer::load_artboard(const Ref<RiveFile> &p_file, const String &p_artboard_name) {
+    ERR_FAIL_COND_V(p_file.is_null(), false);
+
+    std::unique_ptr<rive::ArtboardInstance> ab = p_file->instantiate_artboard(p_artboard_name);
+    if (!ab) return false;
+
+    set_memory_stats(p_file->get_memory_stats());
+    set_artboard(std::move(ab), rive::ref_rcp(p_file->get_rive_file()));
+    return true;
+}
+
 void RivePlayer::set_artboard(std::unique_ptr<rive::ArtboardInstance> p_artboard, rive::rcp<rive::File> p_file) {
+    finish_advance();
+    RIVE_PROFILE_ZONE("RivePlayer::set_artboard");
+    std::unique_ptr<RiveBundle> bundle = bundle_shell ? std::move(bundle_shell) : std::make_unique<RiveBundle>();
+    bundle->artboard = std::move(p_artboard);
+    // Try to load specified state machine or animation
+    bundle->setup(p_file.get(), current_state_machine, current_animation);
+    adopt_bundle(std::move(bundle), p_file);
+}
+
+void RivePlayer::adopt_bundle(std::unique_ptr<RiveBundle> p_bundle, rive::rcp<rive::File> p_file) {
+    finish_advance();
+    ERR_FAIL_COND(!p_bundle);
+    // Tracked by the player from here on, see _update_memory_usage().
+    p_bundle->release_memory();
+
     state_machine.reset();
     animation.reset();
     view_model_instance = nullptr;
     wrapper_view_model_instance.unref();
-    artboard = std::move(p_artboard);
+    artboard = std::move(p_bundle->artboard);
+    state_machine = std::move(p_bundle->state_machine);
+    animation = std::move(p_bundle->animation);
+    view_model_instance = std::move(p_bundle->view_model_instance);
+    bundle_shell = std::move(p_bundle);
+
+    if (p_file.get() != rive_file.get()) {
+        asset_memory.clear();
+    }
     rive_file = p_file;
+    external_change = true;
+    animating = true;
 
-    if (artboard) {
-        UtilityFunctions::print_verbose("RivePlayer: Advancing artboard 0.0f");
-        artboard->advance(0.0f);
-        UtilityFunctions::print_verbose("RivePlayer: Artboard advanced");
-
-        if (rive_file) {
-            int viewModelId = artboard->viewModelId();
-            if (viewModelId != -1) {
-                view_model_instance = rive_file->createViewModelInstance(viewModelId, 0);
-            }
-
-            if (!view_model_instance) {
-                view_model_instance = rive_file->createViewModelInstance(artboard.get());
-            }
-        }
+    if (state_machine) {
+        current_state_machine = state_machine->name().c_str();
+        current_animation = "";
+    } else if (animation) {
+        current_animation = animation->name().c_str();
+        current_state_machine = "";
+    }
 
-        // Try to load specified state machine or animation
-        if (!current_state_machine.is_empty()) {
-            state_machine = artboard->stateMachineNamed(current_state_machine.utf8().get_data());
-        }
+    _update_memory_usage();
+}
 
-        if (!state_machine && !current_animation.is_empty()) {
-            animation = artboard->animationNamed(current_animation.utf8().get_data());
-        }
+std::unique_ptr<RiveBundle> RivePlayer::release_bundle() {
+    finish_advance();
+    std::unique_ptr<RiveBundle> bundle = bundle_shell ? std::move(bundle_shell) : std::make_unique<RiveBundle>();
+    wrapper_view_model_instance.unref();
+    bundle->view_model_instance = std::move(view_model_instance);
+    bundle->animation = std::move(animation);
+    bundle->state_machine = std::move(state_machine);
+    bundle->artboard = std::move(artboard);
+    rive_file = nullptr;
+    asset_memory.clear();
+    _update_memory_usage();
+    return bundle;
+}
 
-        // Fallback to defaults if nothing specified or found
-        if (!state_machine && !animation) {
-            if (artboard->stateMachineCount() > 0) {
-                state_machine = artboard->stateMachineAt(0);
-                current_state_machine = state_machine->name().c_str();
-                current_animation = "";
-            } else if (artboard->animationCount() > 0) {
-                animation = artboard->animationAt(0);
-                current_animation = animation->name().c_str();
-                current_state_machine = "";
-            }
-        }
+void RivePlayer::_update_memory_usage() {
+    if (artboard) {
+        artboard_memory.track(memory_stats, RiveMemoryStats::ARTBOARDS, rive_memory::estimate_artboard(artboard.get()));
+    } else {
+        artboard_memory.release();
+    }
 
-        if (state_machine) {
-            if (view_model_instance) {
-                state_machine->bindViewModelInstance(view_model_instance);
-            }
-        } else if (animation) {
-            if (view_model_instance) {
-                artboard->bindViewModelInstance(view_model_instance);
-            }
-        }
+    if (state_machine) {
+        state_machine_memory.track(memory_stats, RiveMemoryStats::STATE_MACHINES, rive_memory::estimate_state_machine(state_machine.get()));
+    } else {
+        state_machine_memory.release();
+    }
 
-        if (view_model_instance) {
-            if (artboard) artboard->advance(0.0f);
-            if (state_machine) state_machine->advance(0.0f);
-            else if (animation) animation->advance(0.0f);
-        }
+    if (view_model_instance) {
+        view_model_memory.track(memory_stats, RiveMemoryStats::VIEW_MODELS, rive_memory::estimate_view_model(view_model_instance.get()));
+    } else {
+        view_model_memory.release();
     }
 }
 
 void RivePlayer::advance(float delta) {
+    finish_advance();
+    // Replays feed their recorded deltas through _apply_event(), live frame deltas would skew them.
+    if (replaying) return;
+    _advance(delta);
+}
+
+// Runs on a worker thread while advance_async() is pending.
+void RivePlayer::_advance_task(void *p_userdata) {
+    RivePlayer *player = static_cast<RivePlayer *>(p_userdata);
+    player->_advance(player->async_delta);
+}
+
+void RivePlayer::advance_async(float delta) {
+    finish_advance();
+    if (replaying) return;
+    async_delta = delta;
+    advance_fence->begin(WorkerThreadPool::get_singleton()->add_native_task(&RivePlayer::_advance_task, this, false, "RivePlayer Advance"));
+}
+
+void RivePlayer::finish_advance() {
+    advance_fence->wait();
+}
+
+void RivePlayer::_advance(float delta) {
+    if (_is_recording()) {
+        recording->add_advance(delta);
+    }
     if (artboard) {
+        RIVE_PROFILE_ZONE("RivePlayer::advance");
+        bool keep_going = false;
         if (state_machine) {
-            state_machine->advance(delta);
+            keep_going = state_machine->advance(delta);
         } else if (animation) {
-            animation->advance(delta);
+            keep_going = animation->advance(delta);
             animation->apply();
         }
-        artboard->advance(delta);
+        bool updated = artboard->advance(delta);
+        animating = keep_going || updated || external_change;
+        external_change = false;
     }
 }
 
 void RivePlayer::draw(rive::Renderer *renderer, const rive::Mat2D &transform) {
+    finish_advance();
     if (artboard) {
+        RIVE_PROFILE_ZONE("RivePlayer::draw");
         renderer->save();
         renderer->transform(transform);
         artboard->draw(renderer);
@@ -124,6 +241,7 @@ void RivePlayer::draw(rive::Renderer *renderer, const rive::Mat2D &transform) {
 }
 
 bool RivePlayer::hit_test(Vector2 position, const rive::Mat2D &transform) {
+    finish_advance();
     if (!state_machine) return false;
     
     rive::Mat2D inverse;
@@ -134,55 +252,82 @@ bool RivePlayer::hit_test(Vector2 position, const rive::Mat2D &transform) {
 }
 
 bool RivePlayer::pointer_down(Vector2 position, const rive::Mat2D &transform) {
-    if (!state_machine) return false;
-    
     rive::Mat2D inverse;
     if (!transform.invert(&inverse)) return false;
 
-    rive::Vec2D rive_pos = inverse * rive::Vec2D(position.x, position.y);
-    return state_machine->pointerDown(rive_pos) != rive::HitResult::none;
+    return _pointer_event(RiveRecording::EVENT_POINTER_DOWN, inverse * rive::Vec2D(position.x, position.y));
 }
 
 bool RivePlayer::pointer_up(Vector2 position, const rive::Mat2D &transform) {
-    if (!state_machine) return false;
-    
     rive::Mat2D inverse;
     if (!transform.invert(&inverse)) return false;
 
-    rive::Vec2D rive_pos = inverse * rive::Vec2D(position.x, position.y);
-    return state_machine->pointerUp(rive_pos) != rive::HitResult::none;
+    return _pointer_event(RiveRecording::EVENT_POINTER_UP, inverse * rive::Vec2D(position.x, position.y));
 }
 
 bool RivePlayer::pointer_move(Vector2 position, const rive::Mat2D &transform) {
-    if (!state_machine) return false;
-    
     rive::Mat2D inverse;
     if (!transform.invert(&inverse)) return false;
 
-    rive::Vec2D rive_pos = inverse * rive::Vec2D(position.x, position.y);
-    return state_machine->pointerMove(rive_pos) != rive::HitResult::none;
+    return _pointer_event(RiveRecording::EVENT_POINTER_MOVE, inverse * rive::Vec2D(position.x, position.y));
+}
+
+// p_position is in artboard space, which is what gets recorded so replays don't depend on layout.
+bool RivePlayer::_pointer_event(RiveRecording::EventType p_type, rive::Vec2D p_position) {
+    finish_advance();
+    if (!state_machine) return false;
+
+    if (_is_recording()) {
+        recording->add_pointer(p_type, p_position.x, p_position.y);
+    }
+    external_change = true;
+
+    switch (p_type) {
+        case RiveRecording::EVENT_POINTER_DOWN:
+            return state_machine->pointerDown(p_position) != rive::HitResult::none;
+        case RiveRecording::EVENT_POINTER_UP:
+            return state_machine->pointerUp(p_position) != rive::HitResult::none;
+        case RiveRecording::EVENT_POINTER_MOVE:
+            return state_machine->pointerMove(p_position) != rive::HitResult::none;
+        default:
+            return false;
+    }
 }
 
 void RivePlayer::play_animation(const String &p_name) {
+    finish_advance();
     if (!artboard) return;
 
+    if (_is_recording()) {
+        recording->add_named(RiveRecording::EVENT_PLAY_ANIMATION, p_name);
+    }
+    external_change = true;
+
     state_machine.reset();
     animation = artboard->animationNamed(p_name.utf8().get_data());
     if (animation) {
         current_animation = p_name;
         current_state_machine = "";
     }
+    _update_memory_usage();
 }
 
 void RivePlayer::play_state_machine(const String &p_name) {
+    finish_advance();
     if (!artboard) return;
 
+    if (_is_recording()) {
+        recording->add_named(RiveRecording::EVENT_PLAY_STATE_MACHINE, p_name);
+    }
+    external_change = true;
+
     animation.reset();
     state_machine = artboard->stateMachineNamed(p_name.utf8().get_data());
     if (state_machine) {
         current_state_machine = p_name;
         current_animation = "";
     }
+    _update_memory_usage();
 }
 
 PackedStringArray RivePlayer::get_animation_list() const {
@@ -206,10 +351,201 @@ PackedStringArray RivePlayer::get_state_machine_list() const {
 }
 
 Ref<RiveViewModelInstance> RivePlayer::get_rive_view_model_instance() {
+    finish_advance();
     if (wrapper_view_model_instance.is_null() && view_model_instance) {
         wrapper_view_model_instance.instantiate();
         wrapper_view_model_instance->_init(view_model_instance);
+        wrapper_view_model_instance->set_advance_fence(advance_fence);
     }
     return wrapper_view_model_instance;
 }
 
+rive::ViewModelInstance *RivePlayer::resolve_view_model_instance(rive::ViewModelInstance *p_root, const String &p_path, String &r_property_name) {
+    if (!p_root) return nullptr;
+
+    PackedStringArray parts = p_path.split(".");
+    rive::ViewModelInstance *current = p_root;
+
+    for (int i = 0; i < parts.size() - 1; ++i) {
+        rive::ViewModelInstanceValue *prop = current->propertyValue(parts[i].utf8().get_data());
+        if (!prop) return nullptr;
+
+        rive::ViewModelInstanceViewModel *vm_prop = prop->as<rive::ViewModelInstanceViewModel>();
+        if (!vm_prop) return nullptr;
+
+        current = vm_prop->referenceViewModelInstance().get();
+        if (!current) return nullptr;
+    }
+
+    r_property_name = parts[parts.size() - 1];
+    return current;
+}
+
+void RivePlayer::set_view_model_value(const String &p_property_path, const Variant &p_value) {
+    finish_advance();
+    String prop_name;
+    rive::ViewModelInstance *target_vm = resolve_view_model_instance(view_model_instance.get(), p_property_path, prop_name);
+    if (!target_vm) return;
+
+    rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
+    if (!prop) return;
+
+    Variant::Type type = p_value.get_type();
+    if (prop->is<rive::ViewModelInstanceNumber>()) {
+        if (type != Variant::FLOAT && type != Variant::INT) return;
+        prop->as<rive::ViewModelInstanceNumber>()->propertyValue((float)p_value);
+    } else if (prop->is<rive::ViewModelInstanceString>()) {
+        if (type != Variant::STRING && type != Variant::STRING_NAME) return;
+        prop->as<rive::ViewModelInstanceString>()->propertyValue(std::string(String(p_value).utf8().get_data()));
+    } else if (prop->is<rive::ViewModelInstanceBoolean>()) {
+        if (type != Variant::BOOL) return;
+        prop->as<rive::ViewModelInstanceBoolean>()->propertyValue((bool)p_value);
+    } else if (prop->is<rive::ViewModelInstanceEnum>()) {
+        if (type != Variant::INT) return;
+        prop->as<rive::ViewModelInstanceEnum>()->value((uint32_t)(int)p_value);
+    } else if (prop->is<rive::ViewModelInstanceColor>()) {
+        if (type != Variant::COLOR) return;
+        Color color = p_value;
+        uint32_t a = (uint32_t)(color.a * 255.0f);
+        uint32_t r = (uint32_t)(color.r * 255.0f);
+        uint32_t g = (uint32_t)(color.g * 255.0f);
+        uint32_t b = (uint32_t)(color.b * 255.0f);
+        prop->as<rive::ViewModelInstanceColor>()->propertyValue((a << 24) | (r << 16) | (g << 8) | b);
+    } else {
+        return;
+    }
+    external_change = true;
+
+    if (_is_recording()) {
+        recording->add_named(RiveRecording::EVENT_SET_VIEW_MODEL_VALUE, p_property_path, p_value);
+    }
+}
+
+void RivePlayer::fire_view_model_trigger(const String &p_property_path) {
+    finish_advance();
+    String prop_name;
+    rive::ViewModelInstance *target_vm = resolve_view_model_instance(view_model_instance.get(), p_property_path, prop_name);
+    if (!target_vm) return;
+
+    rive::ViewModelInstanceValue *prop = target_vm->propertyValue(prop_name.utf8().get_data());
+    if (!prop || !prop->is<rive::ViewModelInstanceTrigger>()) return;
+
+    prop->as<rive::ViewModelInstanceTrigger>()->trigger();
+    external_change = true;
+
+    if (_is_recording()) {
+        recording->add_named(RiveRecording::EVENT_FIRE_VIEW_MODEL_TRIGGER, p_property_path);
+    }
+}
+
+void RivePlayer::start_recording() {
+    finish_advance();
+    recording.instantiate();
+    recording->begin();
+
+    // Replays start from whatever the target player has loaded, so pin the current mode first.
+    if (!current_state_machine.is_empty()) {
+        recording->add_named(RiveRecording::EVENT_PLAY_STATE_MACHINE, current_state_machine);
+    } else if (!current_animation.is_empty()) {
+        recording->add_named(RiveRecording::EVENT_PLAY_ANIMATION, current_animation);
+    }
+}
+
+Ref<RiveRecording> RivePlayer::stop_recording() {
+    finish_advance();
+    Ref<RiveRecording> result = recording;
+    recording.unref();
+    return result;
+}
+
+void RivePlayer::_apply_event(const RiveRecording::Event &p_event) {
+    switch (p_event.type) {
+        case RiveRecording::EVENT_ADVANCE:
+            _advance(p_event.x);
+            break;
+        case RiveRecording::EVENT_POINTER_DOWN:
+        case RiveRecording::EVENT_POINTER_UP:
+        case RiveRecording::EVENT_POINTER_MOVE:
+            _pointer_event(p_event.type, rive::Vec2D(p_event.x, p_event.y));
+            break;
+        case RiveRecording::EVENT_PLAY_ANIMATION:
+            play_animation(p_event.name);
+            break;
+        case RiveRecording::EVENT_PLAY_STATE_MACHINE:
+            play_state_machine(p_event.name);
+            break;
+        case RiveRecording::EVENT_SET_VIEW_MODEL_VALUE:
+            set_view_model_value(p_event.name, p_event.value);
+            break;
+        case RiveRecording::EVENT_FIRE_VIEW_MODEL_TRIGGER:
+            fire_view_model_trigger(p_event.name);
+            break;
+        default:
+            break;
+    }
+}
+
+void RivePlayer::start_replay(const Ref<RiveRecording> &p_recording) {
+    finish_advance();
+    ERR_FAIL_COND(p_recording.is_null());
+    replay_recording = p_recording;
+    replay_position = 0;
+    replaying = true;
+}
+
+// Applies the events of one frame, up to and including the next advance.
+// Returns false once the recording is exhausted.
+bool RivePlayer::replay_step() {
+    finish_advance();
+    if (!replaying || replay_recording.is_null()) return false;
+
+    RIVE_PROFILE_ZONE("RivePlayer::replay_step");
+    uint32_t count = replay_recording->get_event_count();
+    while (replay_position < count) {
+        const RiveRecording::Event &event = replay_recording->get_event(replay_position++);
+        _apply_event(event);
+        if (event.type == RiveRecording::EVENT_ADVANCE) break;
+    }
+
+    if (replay_position >= count) {
+        replaying = false;
+        replay_recording.unref();
+    }
+    return true;
+}
+
+int RivePlayer::replay(const Ref<RiveRecording> &p_recording) {
+    ERR_FAIL_COND_V(p_recording.is_null(), 0);
+
+    start_replay(p_recording);
+    int frames = 0;
+    while (replay_step()) {
+        frames++;
+    }
+    return frames;
+}
+
+Ref<Image> RivePlayer::render_to_image(const Vector2i &p_size) {
+    finish_advance();
+    ERR_FAIL_COND_V(!artboard, Ref<Image>());
+    ERR_FAIL_COND_V(p_size.x <= 0 || p_size.y <= 0, Ref<Image>());
+
+    if (snapshot_target.is_null()) {
+        snapshot_target.instantiate();
+    }
+    snapshot_target->resize(p_size);
+    ERR_FAIL_COND_V_MSG(!snapshot_target->is_valid(), Ref<Image>(), "RivePlayer: Current rendering driver has no readable render target.");
+
+    RivePlayerSnapshot snapshot;
+    snapshot.player = this;
+    snapshot.transform = rive::computeAlignment(
+        rive::Fit::contain,
+        rive::Alignment::center,
+        rive::AABB(0, 0, p_size.x, p_size.y),
+        artboard->bounds());
+
+    RenderingDevice *rd = RenderingServer::get_singleton()->get_rendering_device();
+    rive_integration::render_texture(rd, snapshot_target->get_texture_rid(), &snapshot, p_size.x, p_size.y);
+
+    return snapshot_target->get_image();
+}
@@ -6,6 +6,7 @@
 #include <godot_cpp/classes/input_event_mouse.hpp>
 #include <godot_cpp/classes/input_event_mouse_motion.hpp>
 #include <godot_cpp/classes/input_event_mouse_button.hpp>
+#include <godot_cpp/classes/image.hpp>
 
 #include <rive/file.hpp>
 #include <rive/artboard.hpp>
@@ -14,6 +15,13 @@
 #include <rive/viewmodel/viewmodel_instance.hpp>
 #include <rive/renderer.hpp>
 #include "rive_view_model.h"
+#include "rive_recording.h"
+#include "rive_advance_fence.h"
+#include "../resources/rive_memory.h"
+#include "../resources/rive_bundle.h"
+
+class RiveFile;
+class RiveTextureTarget;
 
 using namespace godot;
 
@@ -31,6 +39,37 @@ private:
     String current_animation;
     String current_state_machine;
 
+    // See is_animating(). external_change covers input and writes made between advances.
+    bool animating = true;
+    bool external_change = true;
+
+    std::shared_ptr<RiveMemoryStats> memory_stats;
+    std::vector<RiveMemoryHandle> asset_memory;
+    RiveMemoryHandle artboard_memory;
+    RiveMemoryHandle state_machine_memory;
+    RiveMemoryHandle view_model_memory;
+
+    Ref<RiveTextureTarget> snapshot_target;
+    // Emptied by adopt_bundle() and refilled by release_bundle(), so handing bundles back
+    // and forth doesn't allocate.
+    std::unique_ptr<RiveBundle> bundle_shell;
+
+    Ref<RiveRecording> recording;
+    Ref<RiveRecording> replay_recording;
+    uint32_t replay_position = 0;
+    bool replaying = false;
+
+    void _update_memory_usage();
+    bool _pointer_event(RiveRecording::EventType p_type, rive::Vec2D p_position);
+    void _apply_event(const RiveRecording::Event &p_event);
+    bool _is_recording() const { return recording.is_valid() && !replaying; }
+
+    // Pending while advance_async() runs on a worker. Shared with the view model wrappers.
+    std::shared_ptr<RiveAdvanceFence> advance_fence = std::make_shared<RiveAdvanceFence>();
+    float async_delta = 0.0f;
+    static void _advance_task(void *p_userdata);
+    void _advance(float delta);
+
 protected:
     static void _bind_methods();
 
@@ -38,11 +77,30 @@ public:
     RivePlayer();
     ~RivePlayer();
 
+    // Instances created after this call are charged to p_stats, usually the owning RiveFile's.
+    void set_memory_stats(const std::shared_ptr<RiveMemoryStats> &p_stats) { memory_stats = p_stats; }
+
     bool load_from_bytes(const PackedByteArray &data);
     bool load(rive::rcp<rive::File> file);
+    bool load_artboard(const Ref<RiveFile> &p_file, const String &p_artboard_name);
     void set_artboard(std::unique_ptr<rive::ArtboardInstance> p_artboard, rive::rcp<rive::File> p_file = nullptr);
+    // Takes over a set up bundle, e.g. one from RiveFile::acquire_bundle().
+    void adopt_bundle(std::unique_ptr<RiveBundle> p_bundle, rive::rcp<rive::File> p_file = nullptr);
+    // Gives up the artboard, state machine and view model and leaves the player empty.
+    std::unique_ptr<RiveBundle> release_bundle();
     
+    // Ignored while replaying, the recording supplies the deltas.
     void advance(float delta);
+    // Starts advance(delta) on the WorkerThreadPool and returns. Until finish_advance() the player
+    // must not be touched from elsewhere. Its own methods and its RiveViewModelInstance wrappers
+    // call finish_advance() first, the raw rive accessors below don't. Main thread only.
+    void advance_async(float delta);
+    void finish_advance();
+    bool is_advancing() const { return advance_fence->is_pending(); }
+    // False once the last advance settled: nothing moved and no input or data arrived since.
+    bool is_animating() const { return animating; }
+    // True when input, a data write or an animation switch arrived since the last advance.
+    bool has_external_change() const { return external_change; }
     void draw(rive::Renderer *renderer, const rive::Mat2D &transform);
 
     // Input handling
@@ -63,6 +121,27 @@ public:
 
     Ref<RiveViewModelInstance> get_rive_view_model_instance();
 
+    // Writes a view model property by dot separated path ("nested.property").
+    // The value is converted to the property's type, mismatching types are ignored.
+    void set_view_model_value(const String &p_property_path, const Variant &p_value);
+    void fire_view_model_trigger(const String &p_property_path);
+    static rive::ViewModelInstance *resolve_view_model_instance(rive::ViewModelInstance *p_root, const String &p_path, String &r_property_name);
+
+    // Record/replay. Replay ignores the recorded timestamps and feeds the recorded deltas,
+    // so the same recording produces the same frames on every run.
+    void start_recording();
+    Ref<RiveRecording> stop_recording();
+    // Recording is suspended while a replay runs.
+    bool is_recording() const { return _is_recording(); }
+
+    void start_replay(const Ref<RiveRecording> &p_recording);
+    bool replay_step();
+    int replay(const Ref<RiveRecording> &p_recording);
+    bool is_replaying() const { return replaying; }
+
+    // Renders the artboard fitted (contain, centered) into an offscreen texture and reads it back.
+    Ref<Image> render_to_image(const Vector2i &p_size);
+
     // ViewModel access
     rive::ViewModelInstance *get_view_model_instance() const { return view_model_instance.get(); }
     rive::ArtboardInstance *get_artboard() const { return artboard.get(); }
@@ -0,0 +1,278 @@
+#include "rive_recording.h"
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+// Layout (little endian):
+//   "RIVR" magic, u32 version, u32 event count
+//   per event: u8 type, varint time delta in usec since the previous event, then
+//     ADVANCE                     f32 delta
+//     POINTER_DOWN/UP/MOVE        f32 x, f32 y
+//     PLAY_ANIMATION/STATE_MACHINE string
+//     SET_VIEW_MODEL_VALUE        string path, u32 size, var_to_bytes(value)
+//     FIRE_VIEW_MODEL_TRIGGER     string path
+//   strings are a varint byte length followed by UTF-8.
+
+static const uint8_t RECORDING_MAGIC[4] = { 'R', 'I', 'V', 'R' };
+static const uint32_t RECORDING_VERSION = 1;
+
+namespace {
+
+struct Writer {
+    PackedByteArray &buffer;
+
+    void u8(uint8_t v) { buffer.push_back(v); }
+    void u32(uint32_t v) {
+        for (int i = 0; i < 4; i++) u8((v >> (i * 8)) & 0xFF);
+    }
+    void f32(float v) {
+        uint32_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+        u32(bits);
+    }
+    void varint(uint64_t v) {
+        while (v >= 0x80) {
+            u8((uint8_t)(v | 0x80));
+            v >>= 7;
+        }
+        u8((uint8_t)v);
+    }
+    void bytes(const uint8_t *p_data, int64_t p_size) {
+        int64_t offset = buffer.size();
+        buffer.resize(offset + p_size);
+        memcpy(buffer.ptrw() + offset, p_data, p_size);
+    }
+    void string(const String &s) {
+        CharString utf8 = s.utf8();
+        varint(utf8.length());
+        bytes((const uint8_t *)utf8.get_data(), utf8.length());
+    }
+};
+
+struct Reader {
+    const uint8_t *ptr;
+    int64_t size;
+    int64_t pos = 0;
+    bool error = false;
+
+    // Unsigned, so corrupt lengths near 2^64 can't wrap around into a negative count.
+    bool has(uint64_t n) {
+        if (n > (uint64_t)(size - pos)) error = true;
+        return !error;
+    }
+    uint8_t u8() { return has(1) ? ptr[pos++] : 0; }
+    uint32_t u32() {
+        if (!has(4)) return 0;
+        uint32_t v = 0;
+        for (int i = 0; i < 4; i++) v |= (uint32_t)ptr[pos++] << (i * 8);
+        return v;
+    }
+    float f32() {
+        uint32_t bits = u32();
+        float v;
+        memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+    uint64_t varint() {
+        uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = u8();
+            if (error) return 0;
+            v |= (uint64_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return v;
+        }
+        error = true;
+        return 0;
+    }
+    String string() {
+        uint64_t len = varint();
+        if (!has(len)) return String();
+        String s = String::utf8((const char *)ptr + pos, (int)len);
+        pos += len;
+        return s;
+    }
+};
+
+} // namespace
+
+void RiveRecording::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("get_event_count"), &RiveRecording::get_event_count);
+    ClassDB::bind_method(D_METHOD("get_duration"), &RiveRecording::get_duration);
+    ClassDB::bind_method(D_METHOD("get_frame_count"), &RiveRecording::get_frame_count);
+    ClassDB::bind_method(D_METHOD("clear"), &RiveRecording::clear);
+    ClassDB::bind_method(D_METHOD("get_data"), &RiveRecording::get_data);
+    ClassDB::bind_method(D_METHOD("set_data", "data"), &RiveRecording::set_data);
+    ClassDB::bind_method(D_METHOD("save", "path"), &RiveRecording::save);
+    ClassDB::bind_static_method("RiveRecording", D_METHOD("load_from_file", "path"), &RiveRecording::load_from_file);
+}
+
+void RiveRecording::begin() {
+    events.clear();
+    start_usec = Time::get_singleton()->get_ticks_usec();
+}
+
+void RiveRecording::add_event(const Event &p_event) {
+    events.push_back(p_event);
+}
+
+void RiveRecording::add_advance(float p_delta) {
+    Event event;
+    event.type = EVENT_ADVANCE;
+    event.time_usec = Time::get_singleton()->get_ticks_usec() - start_usec;
+    event.x = p_delta;
+    events.push_back(event);
+}
+
+void RiveRecording::add_pointer(EventType p_type, float p_x, float p_y) {
+    Event event;
+    event.type = p_type;
+    event.time_usec = Time::get_singleton()->get_ticks_usec() - start_usec;
+    event.x = p_x;
+    event.y = p_y;
+    events.push_back(event);
+}
+
+void RiveRecording::add_named(EventType p_type, const String &p_name, const Variant &p_value) {
+    Event event;
+    event.type = p_type;
+    event.time_usec = Time::get_singleton()->get_ticks_usec() - start_usec;
+    event.name = p_name;
+    event.value = p_value;
+    events.push_back(event);
+}
+
+double RiveRecording::get_duration() const {
+    if (events.is_empty()) return 0.0;
+    return events[events.size() - 1].time_usec / 1000000.0;
+}
+
+int RiveRecording::get_frame_count() const {
+    int count = 0;
+    for (const Event &event : events) {
+        if (event.type == EVENT_ADVANCE) count++;
+    }
+    return count;
+}
+
+void RiveRecording::clear() {
+    events.clear();
+}
+
+PackedByteArray RiveRecording::get_data() const {
+    PackedByteArray buffer;
+    Writer w{ buffer };
+
+    w.bytes(RECORDING_MAGIC, 4);
+    w.u32(RECORDING_VERSION);
+    w.u32(events.size());
+
+    uint64_t last_usec = 0;
+    for (const Event &event : events) {
+        w.u8(event.type);
+        w.varint(event.time_usec >= last_usec ? event.time_usec - last_usec : 0);
+        last_usec = event.time_usec;
+
+        switch (event.type) {
+            case EVENT_ADVANCE:
+                w.f32(event.x);
+                break;
+            case EVENT_POINTER_DOWN:
+            case EVENT_POINTER_UP:
+            case EVENT_POINTER_MOVE:
+                w.f32(event.x);
+                w.f32(event.y);
+                break;
+            case EVENT_SET_VIEW_MODEL_VALUE: {
+                w.string(event.name);
+                PackedByteArray value = UtilityFunctions::var_to_bytes(event.value);
+                w.u32(value.size());
+                w.bytes(value.ptr(), value.size());
+            } break;
+            default:
+                w.string(event.name);
+                break;
+        }
+    }
+    return buffer;
+}
+
+Error RiveRecording::set_data(const PackedByteArray &p_data) {
+    Reader r{ p_data.ptr(), p_data.size() };
+
+    if (!r.has(4) || memcmp(p_data.ptr(), RECORDING_MAGIC, 4) != 0) {
+        return ERR_FILE_UNRECOGNIZED;
+    }
+    r.pos = 4;
+    uint32_t version = r.u32();
+    if (version != RECORDING_VERSION) {
+        return ERR_FILE_UNRECOGNIZED;
+    }
+
+    uint32_t count = r.u32();
+    LocalVector<Event> parsed;
+    parsed.reserve(MIN(count, (uint32_t)(p_data.size() / 2)));
+
+    uint64_t time_usec = 0;
+    for (uint32_t i = 0; i < count && !r.error; i++) {
+        Event event;
+        uint8_t type = r.u8();
+        if (type >= EVENT_MAX) {
+            return ERR_FILE_CORRUPT;
+        }
+        event.type = (EventType)type;
+        time_usec += r.varint();
+        event.time_usec = time_usec;
+
+        switch (event.type) {
+            case EVENT_ADVANCE:
+                event.x = r.f32();
+                break;
+            case EVENT_POINTER_DOWN:
+            case EVENT_POINTER_UP:
+            case EVENT_POINTER_MOVE:
+                event.x = r.f32();
+                event.y = r.f32();
+                break;
+            case EVENT_SET_VIEW_MODEL_VALUE: {
+                event.name = r.string();
+                uint32_t size = r.u32();
+                if (!r.has(size)) break;
+                event.value = UtilityFunctions::bytes_to_var(p_data.slice(r.pos, r.pos + size));
+                r.pos += size;
+            } break;
+            default:
+                event.name = r.string();
+                break;
+        }
+        parsed.push_back(event);
+    }
+
+    if (r.error) {
+        return ERR_FILE_CORRUPT;
+    }
+
+    events = parsed;
+    return OK;
+}
+
+Error RiveRecording::save(const String &p_path) const {
+    Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+    if (file.is_null()) {
+        return FileAccess::get_open_error();
+    }
+    file->store_buffer(get_data());
+    file->close();
+    return OK;
+}
+
+Ref<RiveRecording> RiveRecording::load_from_file(const String &p_path) {
+    PackedByteArray data = FileAccess::get_file_as_bytes(p_path);
+    ERR_FAIL_COND_V_MSG(data.is_empty(), Ref<RiveRecording>(), "RiveRecording: Cannot read " + p_path);
+
+    Ref<RiveRecording> recording;
+    recording.instantiate();
+    Error err = recording->set_data(data);
+    ERR_FAIL_COND_V_MSG(err != OK, Ref<RiveRecording>(), "RiveRecording: Invalid recording " + p_path);
+    return recording;
+}
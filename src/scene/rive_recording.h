@@ -0,0 +1,66 @@
+#ifndef RIVE_RECORDING_H
+#define RIVE_RECORDING_H
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <cstdint>
+
+using namespace godot;
+
+// Interaction log of a RivePlayer: advance deltas, pointer events (in artboard space),
+// animation/state machine switches and view model writes, each with the time since the
+// recording started. Stored as a compact binary stream, see rive_recording.cpp for the layout.
+class RiveRecording : public RefCounted {
+    GDCLASS(RiveRecording, RefCounted);
+
+public:
+    enum EventType : uint8_t {
+        EVENT_ADVANCE = 0,
+        EVENT_POINTER_DOWN,
+        EVENT_POINTER_UP,
+        EVENT_POINTER_MOVE,
+        EVENT_PLAY_ANIMATION,
+        EVENT_PLAY_STATE_MACHINE,
+        EVENT_SET_VIEW_MODEL_VALUE,
+        EVENT_FIRE_VIEW_MODEL_TRIGGER,
+        EVENT_MAX
+    };
+
+    struct Event {
+        EventType type = EVENT_ADVANCE;
+        uint64_t time_usec = 0;
+        float x = 0.0f; // Advance delta, or pointer position.
+        float y = 0.0f;
+        String name; // Animation, state machine or view model property path.
+        Variant value;
+    };
+
+private:
+    LocalVector<Event> events;
+    uint64_t start_usec = 0;
+
+protected:
+    static void _bind_methods();
+
+public:
+    void begin();
+    void add_event(const Event &p_event);
+    void add_advance(float p_delta);
+    void add_pointer(EventType p_type, float p_x, float p_y);
+    void add_named(EventType p_type, const String &p_name, const Variant &p_value = Variant());
+
+    uint32_t get_event_count() const { return events.size(); }
+    const Event &get_event(uint32_t p_index) const { return events[p_index]; }
+    double get_duration() const;
+    int get_frame_count() const;
+    void clear();
+
+    PackedByteArray get_data() const;
+    Error set_data(const PackedByteArray &p_data);
+
+    Error save(const String &p_path) const;
+    static Ref<RiveRecording> load_from_file(const String &p_path);
+};
+
+#endif // RIVE_RECORDING_H
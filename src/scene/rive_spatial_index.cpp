@@ -0,0 +1,146 @@
+#include "rive_spatial_index.h"
+#include <godot_cpp/core/math.hpp>
+
+// Past this many cells a node is cheaper to test directly than to insert everywhere.
+static const int64_t MAX_CELLS_PER_NODE = 64;
+
+void RiveSpatialIndex::set_cell_size(real_t p_size) {
+    p_size = MAX(p_size, (real_t)1.0);
+    if (p_size == cell_size) return;
+
+    cell_size = p_size;
+
+    // Re-bucket everything with the new size.
+    LocalVector<RiveNode *> nodes;
+    LocalVector<Rect2> bounds;
+    for (const KeyValue<RiveNode *, Entry> &E : entries) {
+        nodes.push_back(E.key);
+        bounds.push_back(E.value.bounds);
+    }
+    clear();
+    for (uint32_t i = 0; i < nodes.size(); i++) {
+        update(nodes[i], bounds[i]);
+    }
+}
+
+Rect2i RiveSpatialIndex::_cells_for(const Rect2 &p_bounds) const {
+    Vector2i from((int32_t)Math::floor(p_bounds.position.x / cell_size), (int32_t)Math::floor(p_bounds.position.y / cell_size));
+    Vector2i to((int32_t)Math::floor(p_bounds.get_end().x / cell_size), (int32_t)Math::floor(p_bounds.get_end().y / cell_size));
+    return Rect2i(from, to - from + Vector2i(1, 1));
+}
+
+void RiveSpatialIndex::_unlink(RiveNode *p_node, Entry &p_entry) {
+    if (p_entry.in_grid) {
+        for (int32_t y = p_entry.cells.position.y; y < p_entry.cells.get_end().y; y++) {
+            for (int32_t x = p_entry.cells.position.x; x < p_entry.cells.get_end().x; x++) {
+                HashMap<uint64_t, LocalVector<RiveNode *>>::Iterator cell = cells.find(_cell_key(x, y));
+                if (cell == cells.end()) continue;
+                cell->value.erase(p_node);
+                if (cell->value.is_empty()) {
+                    cells.remove(cell);
+                }
+            }
+        }
+    } else {
+        unbounded.erase(p_node);
+    }
+}
+
+void RiveSpatialIndex::update(RiveNode *p_node, const Rect2 &p_bounds) {
+    HashMap<RiveNode *, Entry>::Iterator it = entries.find(p_node);
+    if (it == entries.end()) {
+        it = entries.insert(p_node, Entry());
+    } else {
+        _unlink(p_node, it->value);
+    }
+
+    Entry &entry = it->value;
+    entry.bounds = p_bounds;
+    entry.in_grid = false;
+
+    if (p_bounds.has_area()) {
+        entry.cells = _cells_for(p_bounds);
+        entry.in_grid = (int64_t)entry.cells.size.x * entry.cells.size.y <= MAX_CELLS_PER_NODE;
+    }
+
+    if (entry.in_grid) {
+        for (int32_t y = entry.cells.position.y; y < entry.cells.get_end().y; y++) {
+            for (int32_t x = entry.cells.position.x; x < entry.cells.get_end().x; x++) {
+                cells[_cell_key(x, y)].push_back(p_node);
+            }
+        }
+    } else {
+        unbounded.push_back(p_node);
+    }
+}
+
+void RiveSpatialIndex::remove(RiveNode *p_node) {
+    HashMap<RiveNode *, Entry>::Iterator it = entries.find(p_node);
+    if (it == entries.end()) return;
+
+    _unlink(p_node, it->value);
+    entries.remove(it);
+}
+
+void RiveSpatialIndex::clear() {
+    entries.clear();
+    cells.clear();
+    unbounded.clear();
+}
+
+bool RiveSpatialIndex::get_bounds(RiveNode *p_node, Rect2 &r_bounds) const {
+    HashMap<RiveNode *, Entry>::ConstIterator it = entries.find(p_node);
+    if (it == entries.end()) return false;
+
+    r_bounds = it->value.bounds;
+    return true;
+}
+
+void RiveSpatialIndex::query_rect(const Rect2 &p_rect, LocalVector<RiveNode *> &r_nodes) {
+    query_stamp++;
+
+    for (RiveNode *node : unbounded) {
+        Entry &entry = entries[node];
+        if (!entry.bounds.has_area() || entry.bounds.intersects(p_rect)) {
+            r_nodes.push_back(node);
+        }
+    }
+
+    Rect2i range = _cells_for(p_rect);
+    for (int32_t y = range.position.y; y < range.get_end().y; y++) {
+        for (int32_t x = range.position.x; x < range.get_end().x; x++) {
+            HashMap<uint64_t, LocalVector<RiveNode *>>::ConstIterator cell = cells.find(_cell_key(x, y));
+            if (cell == cells.end()) continue;
+
+            for (RiveNode *node : cell->value) {
+                Entry &entry = entries[node];
+                if (entry.stamp == query_stamp) continue;
+                entry.stamp = query_stamp;
+                if (entry.bounds.intersects(p_rect)) {
+                    r_nodes.push_back(node);
+                }
+            }
+        }
+    }
+}
+
+void RiveSpatialIndex::query_point(const Vector2 &p_point, LocalVector<RiveNode *> &r_nodes) {
+    for (RiveNode *node : unbounded) {
+        const Entry &entry = entries[node];
+        if (!entry.bounds.has_area() || entry.bounds.has_point(p_point)) {
+            r_nodes.push_back(node);
+        }
+    }
+
+    // A point lies in exactly one cell, no need to de-duplicate.
+    int32_t x = (int32_t)Math::floor(p_point.x / cell_size);
+    int32_t y = (int32_t)Math::floor(p_point.y / cell_size);
+    HashMap<uint64_t, LocalVector<RiveNode *>>::ConstIterator cell = cells.find(_cell_key(x, y));
+    if (cell == cells.end()) return;
+
+    for (RiveNode *node : cell->value) {
+        if (entries[node].bounds.has_point(p_point)) {
+            r_nodes.push_back(node);
+        }
+    }
+}
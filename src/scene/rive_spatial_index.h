@@ -0,0 +1,49 @@
+#ifndef RIVE_SPATIAL_INDEX_H
+#define RIVE_SPATIAL_INDEX_H
+
+#include <godot_cpp/variant/rect2.hpp>
+#include <godot_cpp/variant/rect2i.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <cstdint>
+
+using namespace godot;
+
+class RiveNode;
+
+// Uniform grid over node bounds in the container's space. Nodes spanning too many cells
+// and nodes without bounds are kept in a flat list and returned by every query.
+class RiveSpatialIndex {
+    struct Entry {
+        Rect2 bounds;
+        Rect2i cells;
+        bool in_grid = false;
+        uint64_t stamp = 0;
+    };
+
+    real_t cell_size = 256.0;
+    HashMap<RiveNode *, Entry> entries;
+    HashMap<uint64_t, LocalVector<RiveNode *>> cells;
+    LocalVector<RiveNode *> unbounded;
+    uint64_t query_stamp = 0;
+
+    static uint64_t _cell_key(int32_t p_x, int32_t p_y) { return ((uint64_t)(uint32_t)p_x << 32) | (uint32_t)p_y; }
+    Rect2i _cells_for(const Rect2 &p_bounds) const;
+    void _unlink(RiveNode *p_node, Entry &p_entry);
+
+public:
+    void set_cell_size(real_t p_size);
+    real_t get_cell_size() const { return cell_size; }
+
+    // An empty rect stores the node as unbounded.
+    void update(RiveNode *p_node, const Rect2 &p_bounds);
+    void remove(RiveNode *p_node);
+    void clear();
+    bool get_bounds(RiveNode *p_node, Rect2 &r_bounds) const;
+
+    // Appends nodes whose bounds intersect p_rect (or contain p_point), unordered, without duplicates.
+    void query_rect(const Rect2 &p_rect, LocalVector<RiveNode *> &r_nodes);
+    void query_point(const Vector2 &p_point, LocalVector<RiveNode *> &r_nodes);
+};
+
+#endif // RIVE_SPATIAL_INDEX_H
@@ -28,6 +28,16 @@ void RiveViewModelProperty::_bind_methods() {
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "property_name"), "", "get_property_name");
 }
 
+void RiveViewModelProperty::set_advance_fence(const std::shared_ptr<RiveAdvanceFence> &p_fence) {
+    advance_fence = p_fence;
+}
+
+void RiveViewModelProperty::_wait_for_advance() const {
+    if (advance_fence) {
+        advance_fence->wait();
+    }
+}
+
 // --- RiveViewModelNumber ---
 
 void RiveViewModelNumber::_bind_methods() {
@@ -44,6 +54,7 @@ void RiveViewModelNumber::_init(rive::rcp<rive::ViewModelInstance> p_owner, rive
 }
 
 void RiveViewModelNumber::set_value(float p_value) {
+    _wait_for_advance();
     if (instance_number) {
         if (instance_number->propertyValue() != p_value) {
             instance_number->propertyValue(p_value);
@@ -53,6 +64,7 @@ void RiveViewModelNumber::set_value(float p_value) {
 }
 
 float RiveViewModelNumber::get_value() const {
+    _wait_for_advance();
     if (instance_number) {
         return instance_number->propertyValue();
     }
@@ -82,6 +94,7 @@ void RiveViewModelString::_init(rive::rcp<rive::ViewModelInstance> p_owner, rive
 }
 
 void RiveViewModelString::set_value(const String& p_value) {
+    _wait_for_advance();
     if (instance_string) {
         std::string val = p_value.utf8().get_data();
         if (instance_string->propertyValue() != val) {
@@ -92,6 +105,7 @@ void RiveViewModelString::set_value(const String& p_value) {
 }
 
 String RiveViewModelString::get_value() const {
+    _wait_for_advance();
     if (instance_string) {
         return String(instance_string->propertyValue().c_str());
     }
@@ -121,6 +135,7 @@ void RiveViewModelBoolean::_init(rive::rcp<rive::ViewModelInstance> p_owner, riv
 }
 
 void RiveViewModelBoolean::set_value(bool p_value) {
+    _wait_for_advance();
     if (instance_boolean) {
         if (instance_boolean->propertyValue() != p_value) {
             instance_boolean->propertyValue(p_value);
@@ -130,6 +145,7 @@ void RiveViewModelBoolean::set_value(bool p_value) {
 }
 
 bool RiveViewModelBoolean::get_value() const {
+    _wait_for_advance();
     if (instance_boolean) {
         return instance_boolean->propertyValue();
     }
@@ -159,6 +175,7 @@ void RiveViewModelColor::_init(rive::rcp<rive::ViewModelInstance> p_owner, rive:
 }
 
 void RiveViewModelColor::set_value(Color p_value) {
+    _wait_for_advance();
     if (instance_color) {
         uint32_t a = (uint32_t)(p_value.a * 255.0f);
         uint32_t r = (uint32_t)(p_value.r * 255.0f);
@@ -174,6 +191,7 @@ void RiveViewModelColor::set_value(Color p_value) {
 }
 
 Color RiveViewModelColor::get_value() const {
+    _wait_for_advance();
     if (instance_color) {
         uint32_t argb = instance_color->propertyValue();
         float a = ((argb >> 24) & 0xFF) / 255.0f;
@@ -211,6 +229,7 @@ void RiveViewModelEnum::_init(rive::rcp<rive::ViewModelInstance> p_owner, rive::
 }
 
 void RiveViewModelEnum::set_value(int p_value) {
+    _wait_for_advance();
     if (instance_enum) {
         if (instance_enum->propertyValue() != (uint32_t)p_value) {
             instance_enum->value((uint32_t)p_value);
@@ -220,6 +239,7 @@ void RiveViewModelEnum::set_value(int p_value) {
 }
 
 int RiveViewModelEnum::get_value() const {
+    _wait_for_advance();
     if (instance_enum) {
         return (int)instance_enum->propertyValue();
     }
@@ -310,6 +330,7 @@ void RiveViewModelTrigger::_init(rive::rcp<rive::ViewModelInstance> p_owner, riv
 }
 
 void RiveViewModelTrigger::fire() {
+    _wait_for_advance();
     if (instance_trigger) {
         instance_trigger->trigger();
         emit_signal("triggered");
@@ -336,6 +357,7 @@ void RiveViewModelImage::_init(rive::rcp<rive::ViewModelInstance> p_owner, rive:
 }
 
 void RiveViewModelImage::set_value(const Ref<Texture2D>& p_texture) {
+    _wait_for_advance();
     if (!instance_image) return;
     
     if (p_texture.is_null()) {
@@ -373,6 +395,16 @@ void RiveViewModelInstance::_init(rive::rcp<rive::ViewModelInstance> p_instance)
     instance = p_instance;
 }
 
+void RiveViewModelInstance::set_advance_fence(const std::shared_ptr<RiveAdvanceFence> &p_fence) {
+    advance_fence = p_fence;
+}
+
+void RiveViewModelInstance::_wait_for_advance() const {
+    if (advance_fence) {
+        advance_fence->wait();
+    }
+}
+
 static rive::ViewModelInstance *resolve_view_model_instance(rive::ViewModelInstance *root, const String &path, String &out_property_name)
 {
     if (!root)
@@ -416,6 +448,7 @@ Ref<RiveViewModelNumber> RiveViewModelInstance::get_number_property(const String
             Ref<RiveViewModelNumber> ret;
             ret.instantiate();
             ret->_init(instance, prop->as<rive::ViewModelInstanceNumber>());
+            ret->set_advance_fence(advance_fence);
             property_cache[p_path] = ret;
             return ret;
         }
@@ -439,6 +472,7 @@ Ref<RiveViewModelString> RiveViewModelInstance::get_string_property(const String
             Ref<RiveViewModelString> ret;
             ret.instantiate();
             ret->_init(instance, prop->as<rive::ViewModelInstanceString>());
+            ret->set_advance_fence(advance_fence);
             property_cache[p_path] = ret;
             return ret;
         }
@@ -462,6 +496,7 @@ Ref<RiveViewModelBoolean> RiveViewModelInstance::get_boolean_property(const Stri
             Ref<RiveViewModelBoolean> ret;
             ret.instantiate();
             ret->_init(instance, prop->as<rive::ViewModelInstanceBoolean>());
+            ret->set_advance_fence(advance_fence);
             property_cache[p_path] = ret;
             return ret;
         }
@@ -485,6 +520,7 @@ Ref<RiveViewModelColor> RiveViewModelInstance::get_color_property(const String&
             Ref<RiveViewModelColor> ret;
             ret.instantiate();
             ret->_init(instance, prop->as<rive::ViewModelInstanceColor>());
+            ret->set_advance_fence(advance_fence);
             property_cache[p_path] = ret;
             return ret;
         }
@@ -508,6 +544,7 @@ Ref<RiveViewModelEnum> RiveViewModelInstance::get_enum_property(const String& p_
             Ref<RiveViewModelEnum> ret;
             ret.instantiate();
             ret->_init(instance, prop->as<rive::ViewModelInstanceEnum>());
+            ret->set_advance_fence(advance_fence);
             property_cache[p_path] = ret;
             return ret;
         }
@@ -531,6 +568,7 @@ Ref<RiveViewModelTrigger> RiveViewModelInstance::get_trigger_property(const Stri
             Ref<RiveViewModelTrigger> ret;
             ret.instantiate();
             ret->_init(instance, prop->as<rive::ViewModelInstanceTrigger>());
+            ret->set_advance_fence(advance_fence);
             property_cache[p_path] = ret;
             return ret;
         }
@@ -554,6 +592,7 @@ Ref<RiveViewModelImage> RiveViewModelInstance::get_image_property(const String&
             Ref<RiveViewModelImage> ret;
             ret.instantiate();
             ret->_init(instance, prop->as<rive::ViewModelInstanceAssetImage>());
+            ret->set_advance_fence(advance_fence);
             property_cache[p_path] = ret;
             return ret;
         }
@@ -562,6 +601,7 @@ Ref<RiveViewModelImage> RiveViewModelInstance::get_image_property(const String&
 }
 
 bool RiveViewModelInstance::_set(const StringName &p_name, const Variant &p_value) {
+    _wait_for_advance();
     if (!instance) return false;
     
     String name = p_name;
@@ -606,6 +646,7 @@ bool RiveViewModelInstance::_set(const StringName &p_name, const Variant &p_valu
 }
 
 bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const {
+    _wait_for_advance();
     if (!instance) return false;
     
     String name = p_name;
@@ -628,6 +669,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
         Ref<RiveViewModelNumber> ret;
         ret.instantiate();
         ret->_init(instance, prop->as<rive::ViewModelInstanceNumber>());
+        ret->set_advance_fence(advance_fence);
         property_cache[name] = ret;
         r_ret = ret;
         return true;
@@ -635,6 +677,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
         Ref<RiveViewModelString> ret;
         ret.instantiate();
         ret->_init(instance, prop->as<rive::ViewModelInstanceString>());
+        ret->set_advance_fence(advance_fence);
         property_cache[name] = ret;
         r_ret = ret;
         return true;
@@ -642,6 +685,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
         Ref<RiveViewModelBoolean> ret;
         ret.instantiate();
         ret->_init(instance, prop->as<rive::ViewModelInstanceBoolean>());
+        ret->set_advance_fence(advance_fence);
         property_cache[name] = ret;
         r_ret = ret;
         return true;
@@ -649,6 +693,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
         Ref<RiveViewModelColor> ret;
         ret.instantiate();
         ret->_init(instance, prop->as<rive::ViewModelInstanceColor>());
+        ret->set_advance_fence(advance_fence);
         property_cache[name] = ret;
         r_ret = ret;
         return true;
@@ -656,6 +701,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
         Ref<RiveViewModelEnum> ret;
         ret.instantiate();
         ret->_init(instance, prop->as<rive::ViewModelInstanceEnum>());
+        ret->set_advance_fence(advance_fence);
         property_cache[name] = ret;
         r_ret = ret;
         return true;
@@ -663,6 +709,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
         Ref<RiveViewModelTrigger> ret;
         ret.instantiate();
         ret->_init(instance, prop->as<rive::ViewModelInstanceTrigger>());
+        ret->set_advance_fence(advance_fence);
         property_cache[name] = ret;
         r_ret = ret;
         return true;
@@ -670,6 +717,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
         Ref<RiveViewModelImage> ret;
         ret.instantiate();
         ret->_init(instance, prop->as<rive::ViewModelInstanceAssetImage>());
+        ret->set_advance_fence(advance_fence);
         property_cache[name] = ret;
         r_ret = ret;
         return true;
@@ -681,6 +729,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
                 Ref<RiveViewModelInstance> wrapper;
                 wrapper.instantiate();
                 wrapper->_init(child_vm);
+                wrapper->set_advance_fence(advance_fence);
                 child_vm_cache[name] = wrapper;
                 r_ret = wrapper;
                 return true;
@@ -692,6 +741,7 @@ bool RiveViewModelInstance::_get(const StringName &p_name, Variant &r_ret) const
 }
 
 void RiveViewModelInstance::_get_property_list(List<PropertyInfo> *p_list) const {
+    _wait_for_advance();
     if (!instance) return;
     
     std::vector<rive::ViewModelInstanceValue*> props = instance->propertyValues();
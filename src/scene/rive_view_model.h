@@ -7,6 +7,8 @@
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <rive/viewmodel/viewmodel_instance.hpp>
+#include <memory>
+#include "rive_advance_fence.h"
 
 // Forward declarations for Rive types to avoid including everything in header if possible,
 namespace rive {
@@ -29,9 +31,13 @@ class RiveViewModelProperty : public RefCounted {
 
 protected:
     rive::rcp<rive::ViewModelInstance> instance_ref;
+    // Set for wrappers of a player's view model, see RivePlayer::advance_async().
+    std::shared_ptr<RiveAdvanceFence> advance_fence;
     static void _bind_methods();
+    void _wait_for_advance() const;
 
 public:
+    void set_advance_fence(const std::shared_ptr<RiveAdvanceFence> &p_fence);
     virtual String get_property_name() const = 0;
 };
 
@@ -155,14 +161,18 @@ class RiveViewModelInstance : public RefCounted {
 
 private:
     rive::rcp<rive::ViewModelInstance> instance;
+    std::shared_ptr<RiveAdvanceFence> advance_fence;
     mutable HashMap<String, Ref<RiveViewModelProperty>> property_cache;
     mutable HashMap<String, Ref<RiveViewModelInstance>> child_vm_cache;
 
 protected:
     static void _bind_methods();
+    void _wait_for_advance() const;
 
 public:
     void _init(rive::rcp<rive::ViewModelInstance> p_instance);
+    // Passed on to every property and child wrapper created from here on.
+    void set_advance_fence(const std::shared_ptr<RiveAdvanceFence> &p_fence);
     
     Ref<RiveViewModelNumber> get_number_property(const String& p_path);
     Ref<RiveViewModelString> get_string_property(const String& p_path);